@@ -0,0 +1,97 @@
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include "expression.h"
+#include "implicant.h"
+#include "result-cache.h"
+#include "np-canonical.h"
+
+using std::string;
+using std::vector;
+
+// Outcome of one input file
+struct BatchResult {
+    string file;
+    bool ok = false;
+    int variables = 0;
+    size_t primes = 0;
+    size_t essentials = 0;
+    size_t solutions = 0;
+    int literals = 0;     // Literal count of the reported expression
+    string expression;    // First minimal-cost solution, e.g. "A'B + C"
+};
+
+/*
+Minimizes many input files in one process.
+
+Inputs are named by a directory (every *.txt file in it), a glob on the file name
+(e.g. testing/data/v4/test_v4_f0*.txt) or a manifest (@list.txt, one path per line,
+relative paths resolved against the manifest's folder). Results go to one compact
+tab-separated file, one line per input, in input order.
+
+The files are parsed, then minimized by a pool of workers that pull jobs largest first
+(variable count, then minterm and don't-care count) so a big function does not start last
+and hold up the whole batch. Every worker owns an arena of buffers that is reused from one
+function to the next, and each result is stored at its input position.
+
+Functions of up to 6 variables are grouped by NP class (input permutation and negation):
+only the class representative is minimized and its cover is mapped back to every member.
+An optional ResultCache file lets repeated functions skip minimization across runs.
+*/
+class BatchRunner {
+private:
+    // Buffers reused by one worker from one function to the next
+    struct Arena {
+        CachedResult result;  // Result of the job being processed
+        CachedResult mapped;  // That result mapped onto one member of its NP class
+        vector<int> epi_coverage;
+        vector<vector<Implicant>> expressions;
+    };
+
+    size_t thread_count; // 0 = every hardware thread
+    string cache_path;   // Empty = no result cache
+    bool np_classes = true; // Minimize small functions once per NP class
+    size_t cache_hits = 0;
+    size_t cache_misses = 0;
+    size_t np_class_count = 0;
+
+    // Minimizes one parsed expression into arena.result
+    static void minimize(const Expression& expression, Arena& arena, size_t qm_threads);
+
+    // Maps a class representative's result onto a member of the class
+    static void map_result(const CachedResult& from, const NpTransform& transform, CachedResult& to);
+
+    // Fills result from the PIs and solutions of a minimization
+    static void summarize(int variables, const CachedResult& from, BatchResult& result);
+
+public:
+    explicit BatchRunner(size_t threads = 0, const string& cache = "") : thread_count(threads), cache_path(cache) {}
+
+    // Expands a directory, glob or @manifest into a file list (sorted, except manifests keep their order)
+    static bool collect_inputs(const string& spec, vector<string>& files);
+
+    // Minimizes every file; results are in the order of files.
+    // With a cache, functions found in it skip the minimizer and new results are appended to it.
+    vector<BatchResult> run_all(const vector<string>& files);
+
+    // Minimize every function separately instead of once per NP class
+    void set_np_classes(bool enabled) { np_classes = enabled; }
+
+    // Cache statistics of the last run_all()
+    size_t get_cache_hits() const { return cache_hits; }
+    size_t get_cache_misses() const { return cache_misses; }
+
+    // Minimizes every file and writes the results file; returns false if it cannot be written
+    bool run(const vector<string>& files, const string& results_file);
+
+    // Writes the header and one line per result
+    static void write_results(std::ostream& out, const vector<BatchResult>& results);
+
+    // Sum-of-products text of a list of implicants ("0" if empty)
+    static string format_sop(const vector<Implicant>& implicants);
+};
+
+#endif // BATCH_RUNNER_H
@@ -0,0 +1,50 @@
+#ifndef COMBINE_ENGINE_H
+#define COMBINE_ENGINE_H
+
+// Standard Library Includes //
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Project Includes //
+#include "implicant.h"
+
+// Namespace Usage //
+using std::vector;
+
+/*
+Hash-join prime implicant generator.
+
+Every implicant of a level is bucketed by its dash mask. Two implicants combine only when they
+share a mask and their values differ in a single bit, so instead of comparing every pair of
+adjacent groups, each implicant probes its bucket once per free 0-bit for the partner that has
+that bit set. New implicants are deduplicated through a hash set, which keeps each level close
+to linear in its size.
+
+Large levels are split into fixed-size tiles that run on the shared work-stealing pool. Every
+tile only reads the buckets and writes its own output buffer and used flags; the buffers are then
+merged in tile order, so the result does not depend on the number of threads.
+*/
+class CombineEngine {
+  // Member variables //
+  int numberOfBits;
+  size_t thread_count; // 0 = all workers of the shared pool, 1 = serial
+
+  public:
+  // Constructors //
+  explicit CombineEngine(int, size_t = 0);
+
+  // Member functions //
+
+  // Combines the starting implicants level by level; the primes are returned sorted
+  void generate_primes(const vector<Implicant>&, vector<Implicant>&) const;
+
+  // Combines one level into the next; used[i] is set for every implicant that merged.
+  // Returns true if anything was combined.
+  bool combine_level(const vector<Implicant>&, vector<Implicant>&, vector<uint8_t>&) const;
+
+  // Destructor //
+  ~CombineEngine() = default;
+};
+
+#endif // COMBINE_ENGINE_H
@@ -0,0 +1,74 @@
+#ifndef COMBINE_KERNELS_H
+#define COMBINE_KERNELS_H
+
+// Standard Library Includes //
+#include <cstddef>
+#include <cstdint>
+
+// Project Includes //
+#include "implicant.h"
+#include "../utils/enums.utils.h"
+
+/*
+Inner kernel of the pairwise combine loop.
+
+Given one implicant (value, mask) and a block of candidates stored as separate value and mask
+arrays, the kernel writes the index of every candidate that has the same mask and whose value
+differs in exactly one bit, and returns how many it found. The scalar kernel is always
+available; the AVX2 and AVX-512 kernels test 4 and 8 64-bit candidates per instruction and are
+only selected when CPUID reports support for them.
+*/
+namespace combine_kernels {
+
+  using word = Implicant::word;
+
+  // Signature shared by every kernel
+  using KernelFn = size_t (*)(word, word, const word*, const word*, size_t, uint32_t*);
+
+  // Kernel implementations
+  size_t find_neighbors_scalar(word, word, const word*, const word*, size_t, uint32_t*);
+  size_t find_neighbors_avx2(word, word, const word*, const word*, size_t, uint32_t*);
+  size_t find_neighbors_avx512(word, word, const word*, const word*, size_t, uint32_t*);
+
+  // True if the running CPU (and this build) can execute the given kernel
+  bool is_supported(CombineKernel);
+
+  // Returns the requested kernel, or the widest supported one for CombineKernel::$auto.
+  // Unsupported requests fall back to the scalar kernel.
+  KernelFn select(CombineKernel = CombineKernel::$auto);
+
+  // Name of the kernel that select() would return
+  const char* name(CombineKernel = CombineKernel::$auto);
+
+  /*
+  Probe kernel of the cube-expansion engine.
+
+  The care points sit in an open-addressing table of 2^bits slots (1 <= bits <= 32) with linear
+  probing; EMPTY_SLOT marks a free slot, and a point starts at probe_slot(point, bits). The kernel
+  tells whether every point of a block is in the table. The AVX2 and AVX-512 kernels hash and
+  gather 4 and 8 points per instruction and finish lanes that hit another point with the scalar
+  probe. EMPTY_SLOT itself always reads as present, so the caller tracks that point separately.
+  */
+
+  constexpr word EMPTY_SLOT = ~word(0);
+
+  // Home slot of a point: multiplicative hash of its folded halves
+  inline size_t probe_slot(word point, int bits) {
+    uint32_t key = static_cast<uint32_t>(point ^ (point >> 32));
+    return static_cast<uint32_t>(key * 0x9E3779B1u) >> (32 - bits);
+  }
+
+  // Signature shared by every probe kernel: [slots], [bits], [points], [count]
+  using ProbeFn = bool (*)(const word*, int, const word*, size_t);
+
+  // Probe kernel implementations
+  bool contains_all_scalar(const word*, int, const word*, size_t);
+  bool contains_all_avx2(const word*, int, const word*, size_t);
+  bool contains_all_avx512(const word*, int, const word*, size_t);
+
+  // Probe kernel of the same width select() would pick
+  ProbeFn select_probe(CombineKernel = CombineKernel::$auto);
+
+}
+
+#endif // COMBINE_KERNELS_H
@@ -0,0 +1,40 @@
+#ifndef COVER_REDUCTION_H
+#define COVER_REDUCTION_H
+
+// Standard Library Includes //
+#include <vector>
+#include <cstddef>
+
+// Namespace Usage //
+using std::vector;
+
+// Counters reported by the cyclic-core reduction
+struct CoverReductionStats {
+  size_t passes = 0; // Reduction passes until nothing changed
+  size_t dominated_minterms = 0; // Minterms dropped because another minterm's PIs are a subset of theirs
+  size_t dominated_pis = 0; // PIs dropped because another PI covers a superset at no higher cost
+  size_t secondary_essentials = 0; // PIs that became essential after a reduction
+  size_t core_minterms = 0; // Minterms left in the cyclic core
+  size_t core_pis = 0; // PIs left in the cyclic core
+};
+
+/*
+Cyclic-core reduction of a covering table.
+
+rows[r] lists the PIs (by index) that cover minterm r. Each pass takes the PIs that are the only
+cover of some minterm (secondary essentials), drops minterms whose PI list includes another
+minterm's list, and drops PIs whose minterms are a subset of another PI's at no lower cost. The
+passes repeat until nothing changes; what is left is the cyclic core.
+
+Dropping dominated PIs keeps at least one minimum cover but can discard other covers of the same
+size, so callers that need every minimum cover can switch that step off.
+*/
+class CoverReduction {
+  public:
+  // [rows], [PI costs], [chosen PIs (appended)], [total cost of chosen PIs], [statistics or nullptr], [drop dominated PIs]
+  // Returns false if some minterm can no longer be covered.
+  static bool reduce(vector<vector<int>>&, const vector<long long>&, vector<int>&, long long&,
+                     CoverReductionStats* = nullptr, bool = true);
+};
+
+#endif // COVER_REDUCTION_H
@@ -0,0 +1,56 @@
+#ifndef COVER_SOLVER_H
+#define COVER_SOLVER_H
+
+// Standard Library Includes //
+#include <vector>
+#include <cstddef>
+
+// Namespace Usage //
+using std::vector;
+
+/*
+Exact unate covering by branch and bound.
+
+Rows are the minterms that still need covering and columns are candidate implicants; rows[r]
+lists the columns that cover row r. At every node the matrix is first reduced (essential
+columns, row dominance, column dominance) and then bounded from below by a maximal set of rows
+that share no column. The solver branches on including or excluding the most useful column and
+returns one minimum-cost cover without ever expanding the product of sums.
+*/
+class CoverSolver {
+  // Member variables //
+  vector<vector<int>> rows; // Columns covering each row (sorted)
+  vector<long long> costs; // Cost of each column
+  vector<int> best; // Best cover found so far
+  long long best_cost;
+  size_t nodes;
+
+  public:
+  // Constructors //
+
+  // [rows as column lists], [number of columns], [column costs; empty = unit cost]
+  CoverSolver(const vector<vector<int>>&, int, const vector<long long>& = {});
+
+  // Member functions //
+
+  // Returns the columns of a minimum-cost cover in ascending order
+  vector<int> solve();
+
+  // Number of branch-and-bound nodes explored by the last solve()
+  size_t nodes_explored() const { return nodes; }
+
+  // Destructor //
+  ~CoverSolver() = default;
+
+  private:
+  // Applies the CoverReduction passes with this solver's column costs.
+  // Returns false if some row can no longer be covered.
+  bool reduce(vector<vector<int>>&, vector<int>&, long long&) const;
+
+  // Cost of a maximal set of pairwise column-disjoint rows
+  long long lower_bound(const vector<vector<int>>&) const;
+
+  void search(vector<vector<int>>, vector<int>, long long);
+};
+
+#endif // COVER_SOLVER_H
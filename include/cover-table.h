@@ -0,0 +1,52 @@
+#ifndef COVER_TABLE_H
+#define COVER_TABLE_H
+
+// Standard Library Includes //
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Project Includes //
+#include "implicant.h"
+
+// Namespace Usage //
+using std::vector;
+
+/*
+Precomputed minimization results for every function of 1 to 4 variables without don't cares.
+
+The table is generated at build time by tools/generate-cover-table.cpp, which runs the regular
+minimizer over all 2^(2^n) truth tables, and is compiled into the program. Each entry holds the
+sorted PIs (one byte each: value in the low nibble, dash mask in the high nibble), the EPIs as a
+32-bit mask and every minimum solution as a 32-bit PI mask. A solution lists its non-essential PIs
+in ascending order followed by the EPIs, exactly as QMMinimizer::minimize returns it.
+*/
+namespace cover_table {
+
+  const int MAX_VARIABLES = 4;
+  const int MAX_PRIMES = 32;
+
+  // Number of entries before the n-variable functions, for n = 1 .. MAX_VARIABLES + 1
+  inline size_t first_entry(int variables) {
+    size_t entries = 0;
+    for(int n = 1; n < variables; n++) entries += size_t(1) << (1 << n);
+    return entries;
+  }
+
+  // Generated data: byte offset of each entry (plus one past the end) and the entries
+  extern const uint32_t OFFSETS[];
+  extern const unsigned char DATA[];
+
+  // Reads the entry of an n-variable function given as a truth table (bit m set = minterm m).
+  // [variables], [truth table], [PIs], [EPIs], [solutions as PI indices]
+  bool lookup(int, uint32_t, vector<Implicant>&, vector<bool>&, vector<vector<int>>&);
+
+  // Appends one encoded entry (used by the generator)
+  void encode(const vector<Implicant>&, const vector<bool>&, const vector<vector<int>>&, vector<unsigned char>&);
+
+  // Decodes the entry at the given bytes: [entry], [variables], [PIs], [EPIs], [solutions]
+  void decode(const unsigned char*, int, vector<Implicant>&, vector<bool>&, vector<vector<int>>&);
+
+}
+
+#endif // COVER_TABLE_H
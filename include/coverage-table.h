@@ -0,0 +1,74 @@
+#ifndef COVERAGE_TABLE_H
+#define COVERAGE_TABLE_H
+
+// Standard Library Includes //
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Project Includes //
+#include "expression.h"
+#include "implicant.h"
+
+// Namespace Usage //
+using std::vector;
+
+/*
+PI x minterm coverage matrix, stored once as bit rows.
+
+by_pi holds one row of minterm bits per PI. Rows are indexed by position in the sorted,
+deduplicated minterm list. The table is built once per run; EPI detection, uncovered-minterm
+calculation and the covering clauses all read from it instead of testing every PI against every
+minterm again. The PIs covering a minterm are gathered only for the rows that are asked for
+(normally the ones the EPIs leave uncovered), one pass over the PI rows for all of them.
+*/
+class CoverageTable {
+  // Member variables //
+  vector<Term> minterms; // Row labels (sorted, unique)
+  size_t pis = 0;
+  size_t minterm_words = 0; // Words per PI row
+  vector<uint64_t> by_pi; // PIs x minterms
+
+  public:
+  // Constructors //
+  CoverageTable() = default;
+
+  // [PIs], [minterms to cover]
+  CoverageTable(const vector<Implicant>&, const vector<Term>&);
+
+  // Member functions //
+  size_t minterm_count() const { return minterms.size(); }
+  size_t pi_count() const { return pis; }
+
+  // Minterm of a row
+  Term minterm(size_t row) const { return minterms[row]; }
+
+  // True if PI pi covers the minterm of row
+  bool covers(size_t pi, size_t row) const { return (by_pi[pi * minterm_words + (row >> 6)] >> (row & 63)) & 1; }
+
+  // Number of PIs covering the minterm of row
+  size_t cover_count(size_t row) const;
+
+  // PIs covering the minterm of row, ascending
+  vector<int> pis_covering(size_t row) const;
+
+  // PIs covering the minterm of each row, ascending: [distinct rows]
+  vector<vector<int>> pis_covering(const vector<int>&) const;
+
+  // Rows covered by PI pi, ascending
+  vector<int> rows_covered_by(size_t pi) const;
+
+  // PIs that are the only cover of some minterm
+  vector<bool> essential_pis() const;
+
+  // Rows not covered by any of the selected PIs, ascending
+  vector<int> uncovered_rows(const vector<bool>&) const;
+
+  // Minterms not covered by any of the selected PIs, ascending
+  vector<Term> uncovered_minterms(const vector<bool>&) const;
+
+  // Destructor //
+  ~CoverageTable() = default;
+};
+
+#endif // COVERAGE_TABLE_H
@@ -0,0 +1,54 @@
+#ifndef CUBE_COVER_H
+#define CUBE_COVER_H
+
+// Standard Library Includes //
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Project Includes //
+#include "implicant.h"
+
+// Namespace Usage //
+using std::vector;
+
+/*
+Operations on covers, i.e. lists of cubes (Implicants) over the same variables.
+
+Variables are addressed by bit position (bit i of the packed value and mask), not by the
+most-significant-first index that generate_product uses. A cube is a set of points, so containment
+and intersection are word operations on (value, mask).
+*/
+namespace cube_cover {
+
+  using word = Implicant::word;
+
+  // True if every point of inner lies in outer
+  inline bool contains(const Implicant &outer, const Implicant &inner) {
+    return (inner.get_mask() & ~outer.get_mask()) == 0 &&
+           ((inner.get_value() ^ outer.get_value()) & ~outer.get_mask()) == 0;
+  }
+
+  // Intersection of two cubes; returns false if they are disjoint
+  bool intersect(const Implicant&, const Implicant&, Implicant&);
+
+  // Cofactor of a cube with respect to bit = value: [cube], [bit], [value], [result].
+  // Returns false if the cube has the opposite literal; otherwise the bit becomes a dash.
+  bool cofactor(const Implicant&, int, bool, Implicant&);
+
+  // Cofactor of every cube of a cover: [cover], [bit], [value], [result]
+  void cofactor(const vector<Implicant>&, int, bool, vector<Implicant>&);
+
+  // Removes duplicate cubes and every cube contained in another one (single-cube containment)
+  void remove_contained(vector<Implicant>&);
+
+  // Bits that appear as a positive literal in some cube and as a negative one in another
+  word binate_bits(const vector<Implicant>&);
+
+  // Binate bit with the most literals in the cover (ties: most balanced, then lowest), or -1 if
+  // the cover is unate
+  int most_binate_bit(const vector<Implicant>&);
+
+}
+
+#endif // CUBE_COVER_H
@@ -0,0 +1,104 @@
+#ifndef ESPRESSO_MINIMIZER_H
+#define ESPRESSO_MINIMIZER_H
+
+// Standard Library Includes //
+#include <vector>
+#include <unordered_set>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+// Project Includes //
+#include "expression.h"
+#include "implicant.h"
+
+// Namespace Usage //
+using std::vector;
+
+// Outcome of a heuristic minimization
+struct EspressoStats {
+  size_t iterations = 0; // EXPAND / IRREDUNDANT (/ REDUCE) passes run
+  size_t cubes = 0; // Cubes in the returned cover
+  size_t literals = 0; // Literals in the returned cover
+  size_t lower_bound = 0; // No cover of the function has fewer literals
+};
+
+/*
+Heuristic two-level minimizer in the style of Espresso.
+
+The cover starts as the on-set minterms and is improved by the EXPAND / IRREDUNDANT / REDUCE loop:
+EXPAND raises literals of each cube while it stays inside the care set (largest cubes first,
+literals ordered by how many other cubes lie across them) and drops the cubes it swallows,
+IRREDUNDANT removes cubes whose minterms are all covered by others (most literals first), and
+REDUCE shrinks each cube to the supercube of the minterms only it covers so the next EXPAND can
+move it elsewhere. The loop stops after the configured number of iterations or as soon as one
+does not lower the cost (cubes, then literals). The result is a prime and irredundant cover;
+every step is polynomial in the number of listed terms.
+
+Containment is tested point by point against a hash set of the care terms, so no off-set is
+built. The same set gives, for each minterm, the variables along which it has a care neighbor.
+Two facts follow: a cube of the cover is an essential prime exactly when it holds a minterm with
+no care neighbor outside the cube, and minterms that no single implicant can share each need a
+cube of their own, whose literal counts add up to a lower bound on any cover.
+*/
+class EspressoMinimizer {
+  using word = Implicant::word;
+
+  // Member variables //
+  int numberOfBits;
+  size_t max_iterations;
+  vector<Term> on; // On-set minterms (sorted, unique)
+  std::unordered_set<Term> care; // Minterms and don't cares
+  std::unordered_map<Term, size_t> on_index; // Minterm -> position in on
+  EspressoStats stats;
+
+  // True if every point of the cube (value, mask) is a care term
+  bool in_care(word, word) const;
+
+  // Bits along which the term has a care neighbor
+  word free_bits(Term) const;
+
+  // Calls f(index in on) for every on-set minterm of the cube
+  template<typename F>
+  void for_each_minterm(const Implicant &cube, F f) const {
+    const word mask = cube.get_mask();
+    for(word sub = mask; ; sub = (sub - 1) & mask) {
+      auto it = on_index.find(cube.get_value() | sub);
+      if (it != on_index.end()) f(it->second);
+      if (sub == 0) break;
+    }
+  }
+
+  // Number of cubes covering each on-set minterm
+  vector<uint32_t> coverage_counts(const vector<Implicant>&) const;
+
+  // The three steps of the loop
+  void expand(vector<Implicant>&) const;
+  void irredundant(vector<Implicant>&) const;
+  void reduce(vector<Implicant>&) const;
+
+  // Literals of a cover
+  size_t literal_count(const vector<Implicant>&) const;
+
+  // Literal lower bound from minterms no implicant can share
+  size_t lower_bound() const;
+
+  public:
+  // Constructors //
+
+  // [expression], [maximum iterations, at least 1]
+  EspressoMinimizer(const Expression&, size_t);
+
+  // Member functions //
+
+  // Minimizes the function: [cover, sorted], [essential prime flags]
+  void minimize(vector<Implicant>&, vector<bool>&);
+
+  // Statistics of the last minimize call
+  const EspressoStats& get_stats() const { return stats; }
+
+  // Destructor //
+  ~EspressoMinimizer() = default;
+};
+
+#endif // ESPRESSO_MINIMIZER_H
@@ -0,0 +1,53 @@
+#ifndef EXPANSION_ENGINE_H
+#define EXPANSION_ENGINE_H
+
+// Standard Library Includes //
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Project Includes //
+#include "expression.h"
+#include "implicant.h"
+#include "combine-kernels.h"
+
+// Namespace Usage //
+using std::vector;
+
+/*
+Direct cube-expansion prime implicant generator for sparse functions.
+
+The care points (minterms and don't cares) go into an open-addressing hash table, and the points
+of a candidate cube are checked against it a block at a time by the probe kernel (AVX2 / AVX-512
+gathers where the CPU has them, see combine_kernels::select_probe). Every cube is grown from its
+lowest point p: only variables where p has a 0 and whose neighbor p | bit is a care point can
+become dashes, and a dash is added when the upper half it brings in lies inside the care set.
+A cube is prime when no variable, in either direction, can be dashed. Because each cube is only
+reached from its lowest point and with its dashes added in increasing order, no cube is visited
+twice and no level of non-prime implicants is ever stored, so the work follows the number of care
+points and the cubes around them rather than 2^n or the size of a combine level.
+
+Seeds are split into tiles on the shared work-stealing pool; every tile writes its own output
+buffer and the primes are sorted at the end, so the result does not depend on the thread count.
+*/
+class ExpansionEngine {
+  // Member variables //
+  int numberOfBits;
+  size_t thread_count; // 0 = all workers of the shared pool, 1 = serial
+  CombineKernel kernel; // Width of the probe kernel
+
+  public:
+  // Constructors //
+  // [variables], [threads], [probe kernel]
+  explicit ExpansionEngine(int, size_t = 0, CombineKernel = CombineKernel::$auto);
+
+  // Member functions //
+
+  // Grows the primes of minterms ∪ don't cares: [minterms], [don't cares], [primes, sorted]
+  void generate_primes(const vector<Term>&, const vector<Term>&, vector<Implicant>&) const;
+
+  // Destructor //
+  ~ExpansionEngine() = default;
+};
+
+#endif // EXPANSION_ENGINE_H
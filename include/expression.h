@@ -2,20 +2,52 @@
 #define EXPRESSION_H
 
 #include <vector>
+#include <cstdint>
+#include "implicant.h"
 using std::vector;
 
+// A minterm or don't care: bit i is variable i, the most significant variable is the highest bit
+using Term = uint64_t;
+
+class TermSet;
+
 class Expression {
 
   // TODO: Handle initialization properly
   // Member variables
   public:
-  int numberOfBits; // Number of bits
-  vector<int> minterms, dontcares; // Lists of minterms and don't cares
+  static constexpr int MAX_BITS = 64; // Terms are 64-bit words
+  static constexpr size_t MAX_EXPANDED_TERMS = size_t(1) << 24; // Most points expand_cubes may add
+
+  int numberOfBits = 0; // Number of bits
+  vector<Term> minterms, dontcares; // Lists of minterms and don't cares
+  // Cubes given as such in the input; their points are not in the lists above (see expand_cubes).
+  // Only don't-care cubes reach a prime engine as cubes (PrimeEngine::$unate); QMMinimizer expands
+  // minterm cubes and ranges into points, since each point is a row of the covering problem
+  vector<Implicant> minterm_cubes, dontcare_cubes;
 
   // Member functions
   public:
   Expression() = default;
   void read();
+  // True if the term fits in numberOfBits bits
+  bool in_range(Term term) const { return numberOfBits >= MAX_BITS || (term >> numberOfBits) == 0; }
+  // Sorts both lists, drops duplicates and the don't cares that are also minterms (cubes stay)
+  void canonicalize();
+  bool has_cubes() const { return !minterm_cubes.empty() || !dontcare_cubes.empty(); }
+  // Points of the minterms, of the don't cares and of both: the listed terms plus the points of
+  // the cubes (overlaps counted twice, saturating)
+  size_t minterm_points() const;
+  size_t dontcare_points() const;
+  size_t care_count() const;
+  // Moves the points of the minterm cubes, and of the don't-care cubes if asked, into the lists
+  // (which may then hold duplicates): [don't-care cubes too]
+  void expand_cubes(bool dontcares_too = true);
+  // Points that are neither minterms nor don't cares (cube points included), as a bitmap when
+  // dense and a sorted array when sparse; at most TermSet::MAX_DENSE_BITS variables
+  TermSet off_set() const;
+  // Value of the function for the inputs (most significant variable first); the lists must be in
+  // canonical form
   bool evalute(const vector<int>&);
 };
 
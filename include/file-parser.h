@@ -6,13 +6,12 @@
 
 using std::string;
 
+// Reads the three-line input format from a memory mapping of the file: terms are scanned in
+// place, range-checked as they are read and stored straight into the minterm / don't-care lists
+// (maxterms into a bitmap that is then complemented), with no intermediate strings.
 class FileParser {
 public:
     static bool parse_file(const string& filename, Expression& expr);
-    
-private:
-    static bool parse_terms_line(const string& line, vector<int>& terms, bool& is_maxterm);
-    static bool parse_dontcares_line(const string& line, vector<int>& dontcares);
 };
 
 #endif // FILE_PARSER_H
\ No newline at end of file
@@ -4,6 +4,10 @@
 // Standard Library Includes //
 #include <vector>
 #include <set>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
 #include <utility>
 #include <cassert>
 #include <stdexcept>
@@ -15,13 +19,22 @@
 using std::vector;
 using std::set;
 using std::pair;
+using std::string;
 
 class Implicant {
-  
+
+  public:
+  // Machine word holding one bit per variable; the most significant variable is the highest bit
+  using word = uint64_t;
+
+  // Largest supported number of variables
+  static constexpr int MAX_BITS = 64;
+
+  private:
   // Member variables //
   int numberOfBits; // Number of bits
-  vector<ImplicantBit> bits; // Bits of Implicant
-  set<int> covering; // Terms covered by the Implicant
+  word value; // Literal values; always 0 under a dash
+  word mask; // 1 where the bit is a dash
 
   // Constructors //
   public:
@@ -30,11 +43,14 @@ class Implicant {
   Note: No default constructor is provided as an Implicant must be initialized with a list of bits.
   */
 
-  // Constructor from a single intger
-  Implicant(int, int);
+  // Constructor from a single term
+  Implicant(word, int);
+
+  // constructor from a list of bits
+  Implicant(const vector<ImplicantBit>&);
 
-  // constructor from a list of bits and an optional set of covered terms
-  Implicant(const vector<ImplicantBit>&, set<int> = {});
+  // Constructor from a packed (value, dash mask) pair
+  Implicant(word, word, int);
 
   // Copy constructor from another implicant
   Implicant(const Implicant&);
@@ -66,6 +82,54 @@ class Implicant {
   Implicant& operator+=(const Implicant&);
 
 
+  // Lazy view over the terms covered by an implicant, in ascending order.
+  // Terms are derived from (value, mask) on the fly; nothing is allocated.
+  class CoveredTerms {
+    word value, mask;
+
+    public:
+    class iterator {
+      word value, mask, sub;
+      bool done;
+
+      public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = word;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const word*;
+      using reference = word;
+
+      iterator(word _value, word _mask, bool _done) : value(_value), mask(_mask), sub(0), done(_done) {}
+
+      word operator*() const { return value | sub; }
+
+      // Next submask of the dash mask in increasing order; wraps to 0 after the last one
+      iterator& operator++() {
+        sub = (sub - mask) & mask;
+        done = (sub == 0);
+        return *this;
+      }
+      iterator operator++(int) { iterator old = *this; ++*this; return old; }
+
+      bool operator==(const iterator &other) const { return done == other.done && (done || sub == other.sub); }
+      bool operator!=(const iterator &other) const { return !(*this == other); }
+    };
+
+    CoveredTerms(word _value, word _mask) : value(_value), mask(_mask) {}
+
+    iterator begin() const { return iterator(value, mask, false); }
+    iterator end() const { return iterator(value, mask, true); }
+
+    // Number of covered terms (2^dashes, saturated at SIZE_MAX)
+    size_t size() const {
+      int dashes = __builtin_popcountll(mask);
+      return (dashes >= static_cast<int>(sizeof(size_t) * 8)) ? SIZE_MAX : (size_t(1) << dashes);
+    }
+
+    // O(1) membership test
+    bool contains(word term) const { return (term & ~mask) == value; }
+  };
+
   // Getters and Setters //
 
   // Returns the number of bits
@@ -74,17 +138,40 @@ class Implicant {
   // Returns the bit at the specified index
   ImplicantBit get_bit(int index) const;
 
-  // Returns a list of covered terms
-  vector<int> get_covered_terms() const;
+  // Returns the packed literal values (0 under every dash)
+  word get_value() const { return value; }
+
+  // Returns the packed dash mask
+  word get_mask() const { return mask; }
+
+  // Returns the number of dashes
+  int get_dash_count() const { return __builtin_popcountll(mask); }
+
+  // Returns a hash of the packed words (for unordered containers)
+  size_t hash() const { return (static_cast<size_t>(mask) * 0x9E3779B97F4A7C15ULL) ^ static_cast<size_t>(value); }
+
+  // Returns a view of the covered terms
+  CoveredTerms get_covered_terms() const { return CoveredTerms(value, mask); }
+
+  // Returns true if the implicant covers the given term
+  bool covers(word term) const { return get_covered_terms().contains(term); }
 
   // Helper //
 
   // Generates a SOP; each pair contains (variable index, negated?)
   vector<pair<int, bool>> generate_product() const;
 
+  // Name of the variable at the given index: A to Z, then x26, x27, ...
+  static string variable_name(int);
+
   // Destructor //
   ~Implicant() = default;
 
 };
 
+// Hash functor so implicants can key unordered containers
+struct ImplicantHash {
+  size_t operator()(const Implicant &implicant) const { return implicant.hash(); }
+};
+
 #endif //IMPLICANT_H
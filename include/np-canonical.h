@@ -0,0 +1,49 @@
+#ifndef NP_CANONICAL_H
+#define NP_CANONICAL_H
+
+// Standard Library Includes //
+#include <cstdint>
+
+// Project Includes //
+#include "expression.h"
+#include "implicant.h"
+
+/*
+Input permutation and negation that turns a class representative back into the original
+function: original(x) = representative(y) where x[perm[i]] = y[i] ^ neg[i] (bit i of a term is
+variable i). Cubes map to cubes under it, so the primes, EPIs and covers of the representative
+map one-to-one onto those of the original function.
+*/
+struct NpTransform {
+  int variables = 0;
+  int perm[6] = {0, 1, 2, 3, 4, 5};
+  uint32_t neg = 0; // Bit i set = y[i] is negated
+
+  // Maps a cube of the representative to the matching cube of the original function
+  Implicant apply(const Implicant&) const;
+
+  bool is_identity() const;
+};
+
+/*
+NP canonical form of functions of up to 6 variables.
+
+The on-set and don't-care set are held as 64-bit truth tables. All n! * 2^n input permutations
+and negations are visited with one variable swap or flip per step (Heap's algorithm for the
+permutations, a Gray code for the negations), each a couple of word operations, and the
+lexicographically smallest (on-set, don't-care set) pair is the representative. Functions in
+the same NP class share a representative, so a batch minimizes it once and maps the cover back.
+
+Output negation (the N in NPN) is not used: the cover of the complement is not a cover of the
+function, so it cannot be mapped back to a sum of products.
+*/
+class NpCanonical {
+  public:
+  static const int MAX_VARIABLES = 6;
+
+  // Writes the representative (same variable count, sorted terms) and the transform back to the
+  // original. Returns false if the function has more than 6 variables or a term out of range.
+  static bool canonicalize(const Expression&, Expression&, NpTransform&);
+};
+
+#endif // NP_CANONICAL_H
@@ -0,0 +1,52 @@
+#ifndef OFFSET_ENGINE_H
+#define OFFSET_ENGINE_H
+
+// Standard Library Includes //
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Project Includes //
+#include "expression.h"
+#include "implicant.h"
+
+// Namespace Usage //
+using std::vector;
+
+/*
+Off-set driven prime implicant generator for functions that are almost everywhere 1.
+
+The primes of ON ∪ DC are the maximal cubes that avoid every off-set point. They are built by
+sharping the off-set points out of the universe one at a time: a prime that contains the point is
+replaced by one cube per dash, with that dash fixed to the value the point does not have, and the
+other primes stay. A new cube (c with bit i fixed) is maximal unless an old prime contains it, and
+such a prime must miss the point on bit i alone, so only those few are checked; new cubes never
+contain each other or an old prime. The work follows the size of the off-set and of the prime
+list, so a function given by a handful of maxterms never has its (nearly 2^n) minterms turned
+into implicants.
+*/
+class OffsetEngine {
+  // Member variables //
+  int numberOfBits;
+
+  // Primes of the complement of the points: [off-set], [primes, unsorted]
+  void sharp(const vector<Term>&, vector<Implicant>&) const;
+
+  public:
+  // Constructors //
+  explicit OffsetEngine(int);
+
+  // Member functions //
+
+  // Off-set size for [variables], [care terms, distinct] (SIZE_MAX if 2^n does not fit a size_t)
+  static size_t off_set_size(int, size_t);
+
+  // Primes of the minterms and don't cares, found from Expression::off_set (at most
+  // TermSet::MAX_DENSE_BITS variables): [expression], [primes, sorted]
+  void generate_primes(const Expression&, vector<Implicant>&) const;
+
+  // Destructor //
+  ~OffsetEngine() = default;
+};
+
+#endif // OFFSET_ENGINE_H
@@ -0,0 +1,104 @@
+#ifndef PI_SET_H
+#define PI_SET_H
+
+// Standard Library Includes //
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Namespace Usage //
+using std::vector;
+
+/*
+Set of prime implicant indices stored as a bitset.
+
+Used for the product terms of Petrick's method: union is a word-wise OR and the subset test is
+(a & ~b) == 0 per word. The number of members is cached because every sort and absorption pass
+orders terms by it.
+*/
+class PiSet {
+  // Member variables //
+  vector<uint64_t> words;
+  size_t members = 0;
+
+  public:
+  // Constructors //
+  PiSet() = default;
+
+  // Empty set able to hold indices [0, capacity)
+  explicit PiSet(size_t capacity) : words((capacity + 63) / 64, 0) {}
+
+  // Member functions //
+
+  // Adds an index
+  void insert(int idx) {
+    uint64_t bit = uint64_t(1) << (idx & 63);
+    uint64_t &word = words[idx >> 6];
+    if (!(word & bit)) {
+      word |= bit;
+      members++;
+    }
+  }
+
+  // Returns true if the index is a member
+  bool contains(int idx) const { return (words[idx >> 6] >> (idx & 63)) & 1; }
+
+  // Number of members
+  size_t size() const { return members; }
+
+  // Union
+  PiSet operator|(const PiSet &other) const {
+    PiSet result(*this);
+    result.members = 0;
+    for(size_t w = 0; w < words.size(); w++) {
+      result.words[w] |= other.words[w];
+      result.members += __builtin_popcountll(result.words[w]);
+    }
+    return result;
+  }
+
+  // True if every member of this set is in the other one
+  bool is_subset_of(const PiSet &other) const {
+    if (members > other.members) return false;
+    for(size_t w = 0; w < words.size(); w++) {
+      if (words[w] & ~other.words[w]) return false;
+    }
+    return true;
+  }
+
+  bool operator==(const PiSet &other) const { return members == other.members && words == other.words; }
+  bool operator!=(const PiSet &other) const { return !(*this == other); }
+
+  // Members in ascending order
+  vector<int> to_vector() const {
+    vector<int> result;
+    result.reserve(members);
+    for(size_t w = 0; w < words.size(); w++) {
+      uint64_t word = words[w];
+      while(word) {
+        result.push_back(static_cast<int>(w * 64 + __builtin_ctzll(word)));
+        word &= word - 1;
+      }
+    }
+    return result;
+  }
+
+  // Hash of the words (for unordered containers)
+  size_t hash() const {
+    size_t h = members;
+    for(uint64_t word : words) {
+      h = (h ^ static_cast<size_t>(word)) * 0x100000001B3ULL;
+    }
+    return h;
+  }
+
+  // Destructor //
+  ~PiSet() = default;
+};
+
+// Hash functor so PI sets can key unordered containers
+struct PiSetHash {
+  size_t operator()(const PiSet &set) const { return set.hash(); }
+};
+
+#endif // PI_SET_H
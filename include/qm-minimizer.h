@@ -6,10 +6,15 @@
 #include <map>
 #include <algorithm>
 #include <set>
+#include <functional>
 
 // Project Includes //
 #include "expression.h"
 #include "implicant.h"
+#include "pi-set.h"
+#include "cover-reduction.h"
+#include "coverage-table.h"
+#include "espresso-minimizer.h"
 
 // Namespace Usage //
 using std::string;
@@ -19,6 +24,19 @@ class QMMinimizer {
   int numberOfBits;
   vector<vector<Implicant>> implicant_groups;
   Expression expression;
+  PrimeEngine prime_engine = PrimeEngine::$auto;
+  size_t table_budget = size_t(64) << 20; // Largest ternary table (bytes) any prime engine choice may allocate
+  size_t thread_count = 0; // 0 = use every hardware thread
+  CombineKernel combine_kernel = CombineKernel::$auto;
+  size_t solution_limit = 0; // 0 = every minimum-cardinality solution
+  CoverEngine cover_engine = CoverEngine::$auto;
+  CoverReductionStats reduction_stats; // From the last cyclic-core reduction
+  CoverageTable coverage; // PI x minterm table of the last run
+  bool use_cover_table = true; // Answer small functions from the precomputed table
+  bool use_truth_table = true; // Minimize functions of up to 6 variables with Minimizer<N>
+  MinimizePath path = MinimizePath::$general; // How the last minimize produced its result
+  size_t heuristic_iterations = 0; // 0 = exact minimization; otherwise EspressoMinimizer iterations
+  EspressoStats heuristic_stats; // From the last heuristic run
 
   // Constructors //
   
@@ -27,6 +45,13 @@ class QMMinimizer {
   */
 
   public:
+  // Receives one solution (PI indices); return false to stop the enumeration
+  using SolutionCallback = std::function<bool(const vector<int>&)>;
+
+  // Minterm cubes are expanded into points here and never seeded as cubes, so their cost follows
+  // the number of points; don't-care cubes are kept for PrimeEngine::$unate. Throws
+  // std::length_error when the minterms cover more than Expression::MAX_EXPANDED_TERMS points;
+  // FileParser rejects such files before they get here
   QMMinimizer(const Expression&);
 
   // Member functions
@@ -35,10 +60,63 @@ class QMMinimizer {
   // Petrick BALD
   // [PIs], [EPIs], [Minimzed expressions as list of implicants]
   void petrick(const vector<Implicant>&, vector<bool>&, vector<vector<int>>&);
+  // Streaming variant: minimum-cardinality solutions are passed to the callback as they are found
+  void petrick(const vector<Implicant>&, vector<bool>&, const SolutionCallback&);
   // minimize
   // [PIs], [EPIs], [EPIs coverage], [Minimzed expressions as list of implicants], [solutions as indices]
   void minimize(vector<Implicant>&, vector<bool>&, vector<int>&, vector<vector<Implicant>>&, vector<vector<int>>&); // AMONIOS
 
+  // Selects the prime implicant generator used by minimize
+  void set_prime_engine(PrimeEngine engine) { prime_engine = engine; }
+
+  // Memory the 3^n ternary table may take; a forced $ternary over it falls back to $expansion
+  void set_table_budget(size_t bytes) { table_budget = bytes; }
+
+  // Generator minimize uses for this function ($auto resolved)
+  PrimeEngine get_prime_engine() const;
+
+  // Limits the worker threads used during prime generation (0 = all, 1 = serial)
+  void set_thread_count(size_t count) { thread_count = count; }
+
+  // Selects the SIMD width (dispatched on CPUID by default) of the comparison kernel of the classic
+  // generator and of the care-set probes of the cube-expansion generator; the other prime engines
+  // ignore it
+  void set_combine_kernel(CombineKernel kernel) { combine_kernel = kernel; }
+
+  // Keeps only the first K minimum-cardinality solutions (0 = all of them).
+  // A non-zero limit switches Petrick to the streaming enumeration, which stops as soon as K are found.
+  void set_solution_limit(size_t limit) { solution_limit = limit; }
+
+  // Selects the covering solver used after EPI extraction
+  void set_cover_engine(CoverEngine engine) { cover_engine = engine; }
+
+  // Finds one minimum cover of the minterms left by the EPIs with the branch-and-bound solver
+  void branch_and_bound(const vector<Implicant>&, vector<bool>&, vector<vector<int>>&);
+
+  // Statistics of the cyclic-core reduction done by the last minimize/petrick/branch_and_bound call
+  const CoverReductionStats& get_reduction_stats() const { return reduction_stats; }
+
+  // Enables the precomputed table for functions of up to 4 variables without don't cares
+  void set_use_cover_table(bool enabled) { use_cover_table = enabled; }
+
+  // Enables the truth-table engine for functions of up to 6 variables
+  void set_use_truth_table(bool enabled) { use_truth_table = enabled; }
+
+  // How the last minimize call produced its result (reduction stats exist only for $general)
+  MinimizePath get_minimize_path() const { return path; }
+
+  // Trades exactness for predictable run time: with k > 0, minimize returns one near-minimal
+  // prime and irredundant cover after at most k EXPAND / IRREDUNDANT / REDUCE iterations and only
+  // the primes of that cover. 0 (the default) keeps the exact minimization, and so do functions
+  // whose don't-care cubes exceed Expression::MAX_EXPANDED_TERMS points.
+  void set_heuristic_iterations(size_t iterations) { heuristic_iterations = iterations; }
+
+  // Statistics of the last heuristic minimize (MinimizePath::$heuristic)
+  const EspressoStats& get_heuristic_stats() const { return heuristic_stats; }
+
+  // Coverage table of the PIs from the last minimize/petrick/branch_and_bound call
+  const CoverageTable& get_coverage() const { return coverage; }
+
   // Select minimal-cost solutions from a set of candidate solutions (cost = total literal count)
   void select_min_cost_solutions(const vector<Implicant>& pe, const vector<vector<int>>& solutions, vector<vector<int>>& out_min_solutions); //ASKANDRANI
 
@@ -46,7 +124,49 @@ class QMMinimizer {
   ~QMMinimizer() = default;
 
   private:
-  vector<set<int>> multiply(const vector<set<int>>&, const vector<set<int>>&);
+  // Prime implicant generators; results are sorted
+  void generate_primes_classic(vector<Implicant>&);
+  void generate_primes_hash_join(vector<Implicant>&);
+  void generate_primes_expansion(vector<Implicant>&);
+  void generate_primes_ternary(vector<Implicant>&);
+  void generate_primes_unate(vector<Implicant>&);
+  void generate_primes_offset(vector<Implicant>&);
+
+  // Fills implicant_groups (care terms grouped by popcount) if it is still empty
+  void build_implicant_groups();
+
+  // Petrick clauses (covering PIs) of the minterms not covered by EPIs, read from the coverage table
+  void build_cover_rows(const vector<Implicant>&, const vector<bool>&, vector<vector<int>>&);
+
+  // Reduces the clauses to the cyclic core: [PIs], [EPIs], [drop dominated PIs], [core], [secondary essentials]
+  void prepare_core(const vector<Implicant>&, const vector<bool>&, bool, vector<vector<int>>&, vector<int>&);
+
+  // Fills [PIs], [EPIs], [solutions] from the precomputed table if the function qualifies
+  bool lookup_cover_table(vector<Implicant>&, vector<bool>&, vector<vector<int>>&);
+
+  // True if CoverEngine::$auto expands this cyclic core with Petrick (every minimum solution)
+  // rather than taking one branch-and-bound solution
+  static bool petrick_fits(const vector<vector<int>>&);
+
+  // Fills [PIs], [EPIs], [solutions] with Minimizer<N> if the function has at most 6 variables
+  bool minimize_truth_table(vector<Implicant>&, vector<bool>&, vector<vector<int>>&);
+
+  // Fills [cover PIs], [EPIs], [the one solution] with EspressoMinimizer if heuristic mode is on
+  bool minimize_heuristic(vector<Implicant>&, vector<bool>&, vector<vector<int>>&);
+
+  // Maps solutions (PI indices) to implicant lists: [PIs], [solutions], [output]
+  void build_expressions(const vector<Implicant>&, const vector<vector<int>>&, vector<vector<Implicant>>&) const;
+
+  // Core solution + secondary essentials (sorted), followed by the EPIs
+  vector<int> assemble_solution(const vector<int>&, const vector<int>&, const vector<bool>&) const;
+
+  // Covering solvers over a reduced core: [PIs], [EPIs], [core], [secondary essentials], [output]
+  void solve_petrick(const vector<Implicant>&, const vector<bool>&, const vector<vector<int>>&, const vector<int>&, vector<vector<int>>&);
+  void solve_streaming(const vector<Implicant>&, const vector<bool>&, const vector<vector<int>>&, const vector<int>&, const SolutionCallback&);
+  void solve_branch_and_bound(const vector<Implicant>&, const vector<bool>&, const vector<vector<int>>&, const vector<int>&, vector<vector<int>>&);
+
+  // Product of two sums of PI sets with absorbed terms removed
+  vector<PiSet> multiply(const vector<PiSet>&, const vector<PiSet>&);
 };
 
 #endif // QM_MINIMIZER_H
\ No newline at end of file
@@ -5,6 +5,10 @@
 #include <vector>
 #include "expression.h"
 #include "implicant.h"
+#include "cover-reduction.h"
+#include "coverage-table.h"
+#include "espresso-minimizer.h"
+#include "../utils/enums.utils.h"
 
 using std::string;
 using std::vector;
@@ -15,16 +19,20 @@ private:
     vector<Implicant> prime_implicants;
     vector<bool> essential_pis;
     vector<int> epi_coverage;
-    vector<int> uncovered_minterms;
+    vector<Term> uncovered_minterms;
     vector<vector<Implicant>> minimized_expressions;
     vector<vector<int>> solution_indices;
     vector<vector<int>> minimal_cost_solution_indices;
     vector<vector<Implicant>> minimal_cost_expressions;
+    CoverReductionStats reduction_stats;
+    MinimizePath minimize_path = MinimizePath::$general;
+    size_t heuristic_iterations = 0; // 0 = exact minimization
+    EspressoStats heuristic_stats;
     
     bool expression_loaded;
     bool minimization_done;
     
-    void calculate_uncovered_minterms();
+    void calculate_uncovered_minterms(const CoverageTable& coverage);
 
 public:
     QuineMcCluskeyDriver();
@@ -37,6 +45,7 @@ public:
     
     // Core workflow
     void run_minimization();
+    void set_heuristic_iterations(size_t iterations) { heuristic_iterations = iterations; } // 0 = exact
     
     // Display methods (as per project requirements)
     void display_prime_implicants() const;        // Requirement 2
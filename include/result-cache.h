@@ -0,0 +1,94 @@
+#ifndef RESULT_CACHE_H
+#define RESULT_CACHE_H
+
+// Standard Library Includes //
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <mutex>
+#include <atomic>
+#include <unordered_map>
+
+// Project Includes //
+#include "expression.h"
+#include "implicant.h"
+#include "mapped_file.h"
+
+// Namespace Usage //
+using std::string;
+using std::vector;
+
+// Minimization result as stored in the cache
+struct CachedResult {
+  vector<Implicant> primes;
+  vector<bool> essentials;
+  vector<vector<int>> solutions; // PI indices
+  vector<vector<int>> min_cost_solutions; // PI indices
+};
+
+/*
+Persistent, content-addressed cache of minimization results.
+
+The key is the number of variables plus the sorted, deduplicated minterm and don't-care
+sets; its 64-bit fingerprint indexes the cache and the full key is stored with every
+record so a fingerprint collision is never taken for a hit. The cache file is a log of
+self-checking records:
+
+  u32 magic, u32 body size, u64 checksum of the body, body
+
+It is mapped read-only when opened, so several batch processes can share it; new records
+are collected in memory and appended under an exclusive file lock by flush(). A record
+that is truncated or fails its checksum (an interrupted writer) ends the scan.
+*/
+class ResultCache {
+  // Member variables //
+  string path;
+  MappedFile file;
+  std::unordered_map<uint64_t, vector<size_t>> index; // fingerprint -> body offsets in the mapping
+  string pending; // Encoded records not yet written
+  std::mutex pending_lock;
+  std::atomic<size_t> hit_count{0};
+  std::atomic<size_t> miss_count{0};
+  size_t stored = 0;
+
+  public:
+  // Constructors //
+  ResultCache() = default;
+  ResultCache(const ResultCache&) = delete;
+  ResultCache& operator=(const ResultCache&) = delete;
+
+  // Member functions //
+
+  // Maps the cache file (a missing file is an empty cache) and indexes its records
+  bool open(const string&);
+
+  // Looks the function up; thread-safe, counts a hit or a miss
+  bool lookup(const Expression&, CachedResult&);
+
+  // Queues a result for the next flush(); thread-safe
+  void store(const Expression&, const CachedResult&);
+
+  // Appends the queued records to the cache file
+  bool flush();
+
+  size_t hits() const { return hit_count.load(); }
+  size_t misses() const { return miss_count.load(); }
+  size_t entries() const { return index.size(); } // Records in the mapped file
+  size_t stored_count() const { return stored; } // Records queued by store()
+
+  // Canonical key: [variables], [sorted unique minterms], [sorted unique don't cares]
+  static void canonical_key(const Expression&, vector<uint64_t>&, vector<uint64_t>&);
+
+  // Fingerprint of a canonical key
+  static uint64_t fingerprint(int, const vector<uint64_t>&, const vector<uint64_t>&);
+
+  // Destructor //
+  ~ResultCache() = default;
+
+  private:
+  // Decodes the record body at offset if its key matches
+  bool decode(size_t, int, const vector<uint64_t>&, const vector<uint64_t>&, CachedResult&) const;
+};
+
+#endif // RESULT_CACHE_H
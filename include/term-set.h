@@ -0,0 +1,92 @@
+#ifndef TERM_SET_H
+#define TERM_SET_H
+
+// Standard Library Includes //
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+// Project Includes //
+#include "expression.h"
+
+// Namespace Usage //
+using std::vector;
+
+/*
+Set of terms over n variables, stored whichever way is smaller.
+
+Dense sets are a bitmap of 2^n bits (bit t of word t / 64 is term t): membership is one load and
+complement, union and difference are word-wise NOT / OR / AND-NOT. Sparse sets are a sorted array
+without duplicates, with binary-search membership. The representation is picked from the size
+(the bitmap is used once it takes no more words than the array would) and re-picked after every
+operation, so a complement of a few maxterms is a bitmap NOT and its result can still be read
+back as a sorted list.
+*/
+class TermSet {
+  // Member variables //
+  int numberOfBits;
+  bool dense = false;
+  vector<uint64_t> bits; // Bitmap (dense)
+  vector<Term> terms; // Sorted terms (sparse)
+  size_t count = 0;
+
+  // Number of 64-bit words of the bitmap
+  size_t word_count() const { return bitmap_words(numberOfBits); }
+
+  // Mask of the valid bits of the last bitmap word
+  uint64_t tail_mask() const;
+
+  // Switches to the representation fits_dense picks
+  void fit();
+  void to_dense();
+  void to_sparse();
+
+  public:
+  static constexpr int MAX_DENSE_BITS = 26; // Largest bitmap: 2^26 bits = 8 MiB
+
+  // Constructors //
+
+  // Empty set: [variables]
+  explicit TermSet(int);
+
+  // [variables], [terms, any order, duplicates allowed]
+  TermSet(int, const vector<Term>&);
+
+  // Member functions //
+
+  // Set read from a bitmap of 2^n bits (bit t of word t / 64 is term t): [variables], [bitmap]
+  static TermSet from_bitmap(int, vector<uint64_t>&&);
+
+  // Words a bitmap over this many variables takes
+  static size_t bitmap_words(int variables) { return ((size_t(1) << variables) + 63) / 64; }
+
+  // True if a set of this many terms over this many variables is stored as a bitmap
+  static bool fits_dense(int, size_t);
+
+  bool contains(Term term) const {
+    if (dense) return (bits[term >> 6] >> (term & 63)) & 1;
+    auto it = std::lower_bound(terms.begin(), terms.end(), term);
+    return it != terms.end() && *it == term;
+  }
+
+  size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+  bool is_dense() const { return dense; }
+  int get_number_of_bits() const { return numberOfBits; }
+
+  // Every term of the space not in the set (at most MAX_DENSE_BITS variables)
+  TermSet complement() const;
+
+  // Set operations on sets over the same variables
+  TermSet united(const TermSet&) const;
+  TermSet without(const TermSet&) const;
+
+  // Terms in ascending order: [output]
+  void to_vector(vector<Term>&) const;
+
+  // Destructor //
+  ~TermSet() = default;
+};
+
+#endif // TERM_SET_H
@@ -0,0 +1,47 @@
+#ifndef TERNARY_ENGINE_H
+#define TERNARY_ENGINE_H
+
+// Standard Library Includes //
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Project Includes //
+#include "expression.h"
+#include "implicant.h"
+
+// Namespace Usage //
+using std::vector;
+
+/*
+Ternary-indexed prime implicant generator for dense mid-size functions.
+
+Every cube of n variables has a base-3 index (digit i is variable i: 0, 1 or 2 for a dash) into a
+flat array of 3^n bytes. Counting up visits the cubes in Implicant order, and both cofactors of a
+cube along a dash have lower indices, so one sequential pass fills implicant-ness: a point is an
+implicant when it is a care point and any other cube is one when both cofactors along its lowest
+dash are. A second sequential pass keeps the implicants that no single dash can enlarge. There are
+no implicant lists and no hashing, which makes it the fastest generator for dense functions as
+long as the table fits in memory.
+*/
+class TernaryEngine {
+  // Member variables //
+  int numberOfBits;
+
+  public:
+  // Constructors //
+  explicit TernaryEngine(int);
+
+  // Member functions //
+
+  // Bytes the table takes for the given number of variables (SIZE_MAX if it does not fit a size_t)
+  static size_t table_size(int);
+
+  // Fills and scans the table: [minterms], [don't cares], [primes, sorted]
+  void generate_primes(const vector<Term>&, const vector<Term>&, vector<Implicant>&) const;
+
+  // Destructor //
+  ~TernaryEngine() = default;
+};
+
+#endif // TERNARY_ENGINE_H
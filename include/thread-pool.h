@@ -0,0 +1,74 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+// Standard Library Includes //
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+// Namespace Usage //
+using std::vector;
+
+/*
+Work-stealing thread pool.
+
+Each worker owns a deque of tasks: it pops from the back of its own deque and, when that runs dry,
+steals from the front of the others. parallel_for() queues one runner per helper thread; the
+runners and the calling thread claim tiles from a shared counter, and the caller only waits for
+tiles another thread is already running, so nested calls from inside a task cannot deadlock the
+pool.
+*/
+class ThreadPool {
+  using Task = std::function<void()>;
+
+  // Per-worker task queue
+  struct Queue {
+    std::mutex lock;
+    std::deque<Task> tasks;
+  };
+
+  // Member variables //
+  vector<std::thread> workers;
+  vector<std::unique_ptr<Queue>> queues;
+  std::mutex sleep_lock;
+  std::condition_variable wake;
+  std::atomic<size_t> queued;
+  std::atomic<size_t> next_queue;
+  bool stopping;
+
+  public:
+  // Constructors //
+
+  // Starts the given number of workers (at least one)
+  explicit ThreadPool(size_t);
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  // Member functions //
+
+  // Number of worker threads
+  size_t size() const { return workers.size(); }
+
+  // Runs body(0) .. body(count - 1) across the pool and returns once all of them finished:
+  // [count], [body], [threads running tiles at once, caller included; 0 = pool size]
+  void parallel_for(size_t, const std::function<void(size_t)>&, size_t = 0);
+
+  // Process-wide pool sized to the hardware concurrency
+  static ThreadPool& shared();
+
+  // Destructor //
+  ~ThreadPool();
+
+  private:
+  void push(size_t, Task);
+  bool try_pop(size_t, Task&);
+  void worker_loop(size_t);
+};
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,187 @@
+#ifndef TRUTH_TABLE_MINIMIZER_H
+#define TRUTH_TABLE_MINIMIZER_H
+
+// Standard Library Includes //
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Project Includes //
+#include "expression.h"
+#include "implicant.h"
+
+// Namespace Usage //
+using std::vector;
+
+/*
+Minimizer for functions of N <= 6 variables, with N fixed at compile time.
+
+The on-set and the care set (on-set | don't cares) are 64-bit truth tables and every one of the
+3^N cubes is visited with its covered terms as a truth-table mask. A cube is an implicant if its
+mask lies inside the care set and prime if no single-variable expansion (mask | mask shifted across
+that variable) still does. Covers are searched over the on-set with fixed-size bitsets by
+iterative deepening, so every minimum-cardinality cover is found. All state lives in std::array
+members sized from N; nothing is allocated on the heap.
+*/
+template<int N>
+class Minimizer {
+  static_assert(N >= 1 && N <= 6, "Minimizer<N> handles 1 to 6 variables");
+
+  public:
+  static constexpr int TERMS = 1 << N;
+  static constexpr int CUBES = (N == 1) ? 3 : (N == 2) ? 9 : (N == 3) ? 27 : (N == 4) ? 81 : (N == 5) ? 243 : 729;
+  static constexpr int SET_WORDS = (CUBES + 63) / 64;
+  static constexpr uint64_t ALL_TERMS = (N == 6) ? ~uint64_t(0) : ((uint64_t(1) << TERMS) - 1);
+
+  // Cube over the term bits: value has 0 under every dash
+  struct Cube {
+    uint32_t value;
+    uint32_t mask;
+    uint64_t terms; // Covered terms as a truth-table mask
+  };
+
+  // Fixed-size set of prime indices
+  using PrimeSet = std::array<uint64_t, SET_WORDS>;
+
+  private:
+  // Member variables //
+  uint64_t on;
+  uint64_t care;
+  std::array<Cube, CUBES> primes;
+  int prime_count = 0;
+
+  // Truth-table positions whose index has bit i set
+  static constexpr uint64_t VARIABLE_MASK[6] = {
+    0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL, 0xF0F0F0F0F0F0F0F0ULL,
+    0xFF00FF00FF00FF00ULL, 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL
+  };
+
+  // State of the cover search
+  struct Search {
+    int limit_size;
+    std::array<int, TERMS> chosen;
+    int chosen_count;
+    PrimeSet forbidden;
+  };
+
+  template<typename Callback>
+  bool search(Search &state, uint64_t covered, Callback &on_cover, bool &found) const {
+    uint64_t open = on & ~covered;
+    if (open == 0) {
+      found = true;
+      return on_cover(state.chosen, state.chosen_count);
+    }
+    if (state.chosen_count == state.limit_size) return true;
+
+    // Branch on the open minterm with the fewest usable primes
+    int best_term = -1;
+    int best_options = CUBES + 1;
+    for(uint64_t rest = open; rest; rest &= rest - 1) {
+      int term = __builtin_ctzll(rest);
+      int options = 0;
+      for(int p = 0; p < prime_count && options < best_options; p++) {
+        if (((primes[p].terms >> term) & 1) && !is_member(state.forbidden, p)) options++;
+      }
+      if (options < best_options) {
+        best_options = options;
+        best_term = term;
+      }
+    }
+
+    // Sibling branches forbid the primes tried before them, so each cover is produced once
+    PrimeSet tried{};
+    bool keep_going = true;
+    for(int p = 0; p < prime_count && keep_going; p++) {
+      if (!((primes[p].terms >> best_term) & 1) || is_member(state.forbidden, p)) continue;
+      state.chosen[state.chosen_count++] = p;
+      keep_going = search(state, covered | primes[p].terms, on_cover, found);
+      state.chosen_count--;
+      state.forbidden[p >> 6] |= uint64_t(1) << (p & 63);
+      tried[p >> 6] |= uint64_t(1) << (p & 63);
+    }
+    for(int w = 0; w < SET_WORDS; w++) state.forbidden[w] &= ~tried[w];
+    return keep_going;
+  }
+
+  static bool is_member(const PrimeSet &set, int p) { return (set[p >> 6] >> (p & 63)) & 1; }
+
+  public:
+  // Constructors //
+
+  // [on-set truth table], [don't-care truth table]
+  Minimizer(uint64_t _on, uint64_t dc) : on(_on & ALL_TERMS), care((_on | dc) & ALL_TERMS) {}
+
+  // Member functions //
+
+  // Generates the primes of the care set in Implicant order; returns how many there are
+  int generate_primes() {
+    prime_count = 0;
+    for(int code = 0; code < CUBES; code++) {
+      // Base-3 digits, most significant for the highest bit: 0 -> $zero, 1 -> $one, 2 -> $dash.
+      // Counting up therefore visits cubes in Implicant::operator< order.
+      uint32_t value = 0, mask = 0;
+      uint64_t terms = ALL_TERMS;
+      for(int i = 0, rest = code; i < N; i++, rest /= 3) {
+        int digit = rest % 3;
+        if (digit == 2) {
+          mask |= uint32_t(1) << i;
+        } else if (digit == 1) {
+          value |= uint32_t(1) << i;
+          terms &= VARIABLE_MASK[i];
+        } else {
+          terms &= ~VARIABLE_MASK[i];
+        }
+      }
+      if (terms & ~care) continue;
+
+      // Prime: dashing any fixed variable leaves the care set
+      bool prime = true;
+      for(int i = 0; i < N && prime; i++) {
+        if ((mask >> i) & 1) continue;
+        int shift = 1 << i;
+        uint64_t expanded = terms | (((value >> i) & 1) ? (terms >> shift) : (terms << shift));
+        if (!((expanded & ~care) & ALL_TERMS)) prime = false;
+      }
+      if (prime) primes[prime_count++] = Cube{value, mask, terms};
+    }
+    return prime_count;
+  }
+
+  const Cube& prime(int p) const { return primes[p]; }
+  int get_prime_count() const { return prime_count; }
+
+  // Primes that are the only cover of some on-set minterm
+  PrimeSet essential_primes() const {
+    uint64_t once = 0, twice = 0;
+    for(int p = 0; p < prime_count; p++) {
+      twice |= once & primes[p].terms;
+      once |= primes[p].terms;
+    }
+    uint64_t unique = once & ~twice & on;
+    PrimeSet essential{};
+    for(int p = 0; p < prime_count; p++) {
+      if (primes[p].terms & unique) essential[p >> 6] |= uint64_t(1) << (p & 63);
+    }
+    return essential;
+  }
+
+  // Calls on_cover(chosen, count) for every minimum-cardinality cover of the on-set
+  // until it returns false; returns the cover size (0 if the on-set is empty)
+  template<typename Callback>
+  int for_each_minimum_cover(Callback on_cover) const {
+    for(int size = 0; size <= TERMS; size++) {
+      Search state{size, {}, 0, {}};
+      bool found = false;
+      bool keep_going = search(state, 0, on_cover, found);
+      if (found || !keep_going) return size;
+    }
+    return -1;
+  }
+};
+
+// Runs Minimizer<numberOfBits> on an expression with every term in range and writes the results
+// the way QMMinimizer::minimize does: [expression], [max solutions, 0 = all], [PIs], [EPIs], [solutions]
+bool truth_table_minimize(const Expression&, size_t, vector<Implicant>&, vector<bool>&, vector<vector<int>>&);
+
+#endif // TRUTH_TABLE_MINIMIZER_H
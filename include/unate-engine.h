@@ -0,0 +1,49 @@
+#ifndef UNATE_ENGINE_H
+#define UNATE_ENGINE_H
+
+// Standard Library Includes //
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Project Includes //
+#include "expression.h"
+#include "implicant.h"
+
+// Namespace Usage //
+using std::vector;
+
+/*
+Unate recursive prime implicant generator (the paradigm Espresso uses).
+
+The care set is a cover of minterm cubes. A cover with no binate variable is unate, and after
+single-cube containment a unate cover holds exactly the primes of its function, so the recursion
+stops there. Otherwise the cover is split on its most binate variable x and the primes are
+
+  P(F) = SCC( x' P(F_x') + x P(F_x) + { p & q : p in P(F_x'), q in P(F_x) } )
+
+where the pairwise intersections are the consensus terms across x and SCC removes every cube
+contained in another. Only the primes of each cofactor are kept on the way up, so the non-prime
+implicants that level-by-level combining stores are never built.
+*/
+class UnateEngine {
+  // Member variables //
+  int numberOfBits;
+
+  public:
+  // Constructors //
+  explicit UnateEngine(int);
+
+  // Member functions //
+
+  // Primes of minterms ∪ don't cares ∪ cubes: [minterms], [don't cares], [cubes], [primes, sorted]
+  void generate_primes(const vector<Term>&, const vector<Term>&, const vector<Implicant>&, vector<Implicant>&) const;
+
+  // Primes of the function given by a cover: [cover], [primes, unsorted]
+  void primes_of(const vector<Implicant>&, vector<Implicant>&) const;
+
+  // Destructor //
+  ~UnateEngine() = default;
+};
+
+#endif // UNATE_ENGINE_H
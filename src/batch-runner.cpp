@@ -0,0 +1,345 @@
+#include "../include/batch-runner.h"
+#include "../include/qm-minimizer.h"
+#include "../include/file-parser.h"
+#include "../include/thread-pool.h"
+#include "../include/result-cache.h"
+#include "../include/np-canonical.h"
+#include "../include/cover-table.h"
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <chrono>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <tuple>
+
+using namespace std;
+namespace fs = std::filesystem;
+
+// Matches a file name against a pattern with '*' and '?' wildcards
+static bool wildcard_match(const string& pattern, const string& name) {
+    size_t p = 0, n = 0;
+    size_t star = string::npos, resume = 0;
+    while (n < name.size()) {
+        if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n])) {
+            p++;
+            n++;
+        } else if (p < pattern.size() && pattern[p] == '*') {
+            star = p++;
+            resume = n;
+        } else if (star != string::npos) {
+            p = star + 1;
+            n = ++resume;
+        } else {
+            return false;
+        }
+    }
+    while (p < pattern.size() && pattern[p] == '*') p++;
+    return p == pattern.size();
+}
+
+bool BatchRunner::collect_inputs(const string& spec, vector<string>& files) {
+    files.clear();
+    error_code ec;
+
+    // Manifest: one path per line, blank lines and '#' comments skipped
+    if (!spec.empty() && spec[0] == '@') {
+        fs::path manifest = spec.substr(1);
+        ifstream in(manifest);
+        if (!in.is_open()) {
+            cerr << "Error: Could not open manifest '" << manifest.string() << "'\n";
+            return false;
+        }
+        string line;
+        while (getline(in, line)) {
+            line.erase(0, line.find_first_not_of(" \t\r"));
+            line.erase(line.find_last_not_of(" \t\r") + 1);
+            if (line.empty() || line[0] == '#') continue;
+            fs::path path = line;
+            if (path.is_relative()) path = manifest.parent_path() / path;
+            files.push_back(path.string());
+        }
+        return true;
+    }
+
+    // Directory: every .txt file in it
+    if (fs::is_directory(spec, ec)) {
+        for (const auto& entry : fs::directory_iterator(spec, ec)) {
+            if (entry.is_regular_file(ec) && entry.path().extension() == ".txt") {
+                files.push_back(entry.path().string());
+            }
+        }
+        sort(files.begin(), files.end());
+        return true;
+    }
+
+    // Glob: wildcards in the file name only
+    if (spec.find_first_of("*?") != string::npos) {
+        fs::path pattern = spec;
+        fs::path dir = pattern.parent_path().empty() ? fs::path(".") : pattern.parent_path();
+        string name_pattern = pattern.filename().string();
+        for (const auto& entry : fs::directory_iterator(dir, ec)) {
+            if (entry.is_regular_file(ec) && wildcard_match(name_pattern, entry.path().filename().string())) {
+                files.push_back((pattern.parent_path() / entry.path().filename()).string());
+            }
+        }
+        if (ec) {
+            cerr << "Error: Could not read directory '" << dir.string() << "'\n";
+            return false;
+        }
+        sort(files.begin(), files.end());
+        return true;
+    }
+
+    // A single file
+    if (fs::is_regular_file(spec, ec)) {
+        files.push_back(spec);
+        return true;
+    }
+
+    cerr << "Error: '" << spec << "' is not a file, directory, glob or @manifest\n";
+    return false;
+}
+
+void BatchRunner::minimize(const Expression& expression, Arena& arena, size_t qm_threads) {
+    // clear() keeps the capacity of every buffer for the next function
+    CachedResult& result = arena.result;
+    result.primes.clear();
+    result.essentials.clear();
+    result.solutions.clear();
+    result.min_cost_solutions.clear();
+    arena.epi_coverage.clear();
+    arena.expressions.clear();
+
+    QMMinimizer qm(expression);
+    qm.set_thread_count(qm_threads);
+    qm.minimize(result.primes, result.essentials, arena.epi_coverage, arena.expressions, result.solutions);
+    qm.select_min_cost_solutions(result.primes, result.solutions, result.min_cost_solutions);
+}
+
+void BatchRunner::map_result(const CachedResult& from, const NpTransform& transform, CachedResult& to) {
+    size_t count = from.primes.size();
+
+    // Map every PI, then restore the sorted PI order and renumber the solutions
+    vector<pair<Implicant, int>> mapped;
+    mapped.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        mapped.emplace_back(transform.apply(from.primes[i]), static_cast<int>(i));
+    }
+    sort(mapped.begin(), mapped.end());
+
+    vector<int> renumber(count);
+    to.primes.clear();
+    to.essentials.assign(count, false);
+    for (size_t i = 0; i < count; i++) {
+        renumber[mapped[i].second] = static_cast<int>(i);
+        to.primes.push_back(mapped[i].first);
+        to.essentials[i] = from.essentials[mapped[i].second];
+    }
+
+    auto map_solutions = [&](const vector<vector<int>>& solutions, vector<vector<int>>& out) {
+        out.resize(solutions.size());
+        for (size_t s = 0; s < solutions.size(); s++) {
+            out[s].clear();
+            for (int idx : solutions[s]) out[s].push_back(renumber[idx]);
+            sort(out[s].begin(), out[s].end());
+        }
+    };
+    map_solutions(from.solutions, to.solutions);
+    map_solutions(from.min_cost_solutions, to.min_cost_solutions);
+}
+
+void BatchRunner::summarize(int variables, const CachedResult& from, BatchResult& result) {
+    result.ok = true;
+    result.variables = variables;
+    result.primes = from.primes.size();
+    result.essentials = count(from.essentials.begin(), from.essentials.end(), true);
+    result.solutions = from.solutions.size();
+
+    vector<Implicant> chosen;
+    if (!from.min_cost_solutions.empty()) {
+        for (int idx : from.min_cost_solutions[0]) {
+            if (idx >= 0 && idx < static_cast<int>(from.primes.size())) {
+                chosen.push_back(from.primes[idx]);
+            }
+        }
+    }
+    for (const auto& implicant : chosen) {
+        result.literals += static_cast<int>(implicant.generate_product().size());
+    }
+    result.expression = format_sop(chosen);
+}
+
+vector<BatchResult> BatchRunner::run_all(const vector<string>& files) {
+    ThreadPool& pool = ThreadPool::shared();
+    size_t workers = (thread_count == 0) ? pool.size() : min(thread_count, pool.size());
+    workers = max<size_t>(1, min(workers, files.size()));
+
+    vector<BatchResult> results(files.size());
+    vector<Expression> expressions(files.size());
+
+    // Each worker pulls the next job from a shared counter until none are left
+    auto run_workers = [&](size_t count, const function<void(size_t, size_t)>& job) {
+        atomic<size_t> next(0);
+        pool.parallel_for(workers, [&](size_t worker) {
+            for (size_t i = next++; i < count; i = next++) {
+                job(worker, i);
+            }
+        });
+    };
+
+    // Parse, and put small functions in NP canonical form
+    vector<char> parsed(files.size(), 0);
+    vector<char> canonical(files.size(), 0);
+    vector<Expression> representatives(files.size());
+    vector<NpTransform> transforms(files.size());
+    run_workers(files.size(), [&](size_t, size_t k) {
+        results[k].file = files[k];
+        parsed[k] = FileParser::parse_file(files[k], expressions[k]);
+        if (!parsed[k]) return;
+        // Small functions are classed and cached by their points
+        if (expressions[k].numberOfBits <= NpCanonical::MAX_VARIABLES) {
+            expressions[k].expand_cubes();
+        }
+        // Functions the precomputed cover table answers directly need no class
+        bool in_table = expressions[k].numberOfBits <= cover_table::MAX_VARIABLES && expressions[k].dontcares.empty();
+        if (np_classes && !in_table) {
+            canonical[k] = NpCanonical::canonicalize(expressions[k], representatives[k], transforms[k]);
+        }
+    });
+
+    // One job per NP class (small functions) or per function (the rest)
+    struct Job {
+        Expression expression;
+        vector<size_t> members; // Input positions sharing this job
+    };
+    vector<Job> jobs;
+    map<tuple<int, vector<Term>, vector<Term>>, size_t> class_of;
+    for (size_t k = 0; k < files.size(); k++) {
+        if (!parsed[k]) continue;
+        if (canonical[k]) {
+            const Expression& rep = representatives[k];
+            auto key = make_tuple(rep.numberOfBits, rep.minterms, rep.dontcares);
+            auto it = class_of.find(key);
+            if (it != class_of.end()) {
+                jobs[it->second].members.push_back(k);
+                continue;
+            }
+            class_of.emplace(move(key), jobs.size());
+            jobs.push_back({rep, {k}});
+        } else {
+            jobs.push_back({move(expressions[k]), {k}});
+        }
+        expressions[k] = Expression();
+    }
+    np_class_count = class_of.size();
+
+    // Largest first: variables, then minterms and don't cares; ties keep input order
+    vector<size_t> order(jobs.size());
+    for (size_t j = 0; j < jobs.size(); j++) order[j] = j;
+    auto weight = [&](size_t j) {
+        const Expression& e = jobs[j].expression;
+        return make_pair(e.numberOfBits, e.care_count());
+    };
+    stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return weight(a) > weight(b); });
+
+    // Minimize; with several workers each function runs its prime generation serially
+    vector<Arena> arenas(workers);
+    size_t qm_threads = (workers > 1) ? 1 : thread_count;
+
+    ResultCache cache;
+    bool use_cache = !cache_path.empty();
+    if (use_cache && !cache.open(cache_path)) {
+        cerr << "Warning: Could not map cache '" << cache_path << "', running without it\n";
+        use_cache = false;
+    }
+
+    run_workers(order.size(), [&](size_t worker, size_t i) {
+        Job& job = jobs[order[i]];
+        Arena& arena = arenas[worker];
+
+        // The cache is keyed by term lists, so functions that kept cubes bypass it
+        bool cached = use_cache && !job.expression.has_cubes();
+        if (!cached || !cache.lookup(job.expression, arena.result)) {
+            minimize(job.expression, arena, qm_threads);
+            if (cached) cache.store(job.expression, arena.result);
+        }
+
+        // Map the class result back to every member
+        for (size_t k : job.members) {
+            if (canonical[k] && !transforms[k].is_identity()) {
+                map_result(arena.result, transforms[k], arena.mapped);
+                summarize(job.expression.numberOfBits, arena.mapped, results[k]);
+            } else {
+                summarize(job.expression.numberOfBits, arena.result, results[k]);
+            }
+        }
+        job.expression = Expression();
+    });
+
+    cache_hits = cache.hits();
+    cache_misses = cache.misses();
+    if (use_cache && !cache.flush()) {
+        cerr << "Warning: Could not append to cache '" << cache_path << "'\n";
+    }
+
+    return results;
+}
+
+bool BatchRunner::run(const vector<string>& files, const string& results_file) {
+    ofstream out(results_file);
+    if (!out.is_open()) {
+        cerr << "Error: Could not create results file '" << results_file << "'\n";
+        return false;
+    }
+
+    auto start = chrono::steady_clock::now();
+    vector<BatchResult> results = run_all(files);
+    write_results(out, results);
+
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    size_t failed = count_if(results.begin(), results.end(), [](const BatchResult& r) { return !r.ok; });
+    cout << "Batch: " << files.size() << " files, " << failed << " failed, "
+         << seconds << " s -> " << results_file << "\n";
+    if (np_classes) {
+        cout << "NP classes: " << np_class_count << " (functions of up to " << NpCanonical::MAX_VARIABLES
+             << " variables are minimized once per class)\n";
+    }
+    if (!cache_path.empty()) {
+        cout << "Cache: " << cache_hits << " hits, " << cache_misses << " misses (" << cache_path << ")\n";
+    }
+    return true;
+}
+
+void BatchRunner::write_results(ostream& out, const vector<BatchResult>& results) {
+    out << "# file\tvars\tprimes\tepis\tsolutions\tliterals\texpression\n";
+    for (const auto& r : results) {
+        if (!r.ok) {
+            out << r.file << "\tERROR\n";
+            continue;
+        }
+        out << r.file << '\t' << r.variables << '\t' << r.primes << '\t' << r.essentials << '\t'
+            << r.solutions << '\t' << r.literals << '\t' << r.expression << '\n';
+    }
+}
+
+string BatchRunner::format_sop(const vector<Implicant>& implicants) {
+    if (implicants.empty()) return "0";
+
+    string text;
+    for (size_t i = 0; i < implicants.size(); i++) {
+        if (i > 0) text += " + ";
+        auto product = implicants[i].generate_product();
+        if (product.empty()) {
+            text += '1';
+            continue;
+        }
+        for (const auto& literal : product) {
+            text += Implicant::variable_name(literal.first);
+            if (literal.second) text += '\'';
+        }
+    }
+    return text;
+}
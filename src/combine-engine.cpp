@@ -0,0 +1,122 @@
+#include "../include/combine-engine.h"
+#include "../include/thread-pool.h"
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+using std::unordered_map;
+using std::unordered_set;
+
+// Levels smaller than this are combined on the calling thread
+static const size_t PARALLEL_THRESHOLD = 4096;
+
+// Constructors
+CombineEngine::CombineEngine(int _numberOfBits, size_t _thread_count)
+  : numberOfBits(_numberOfBits), thread_count(_thread_count) {}
+
+void CombineEngine::generate_primes(const vector<Implicant> &seeds, vector<Implicant> &primes) const {
+  primes.clear();
+
+  // Deduplicate the starting implicants (repeated minterms or overlapping don't cares)
+  vector<Implicant> level;
+  unordered_set<Implicant, ImplicantHash> seen;
+  level.reserve(seeds.size());
+  for(const auto &seed : seeds) {
+    if (seen.insert(seed).second) {
+      level.push_back(seed);
+    }
+  }
+
+  vector<Implicant> next;
+  vector<uint8_t> used;
+  while(!level.empty()) {
+    combine_level(level, next, used);
+
+    // Whatever did not combine at this level is prime
+    for(size_t i = 0; i < level.size(); i++) {
+      if (!used[i]) {
+        primes.push_back(level[i]);
+      }
+    }
+
+    level.swap(next);
+  }
+
+  std::sort(primes.begin(), primes.end());
+}
+
+bool CombineEngine::combine_level(const vector<Implicant> &level, vector<Implicant> &next, vector<uint8_t> &used) const {
+  using word = Implicant::word;
+
+  next.clear();
+  used.assign(level.size(), 0);
+
+  // Bucket by dash mask: mask -> values present with that mask
+  unordered_map<word, unordered_set<word>> buckets;
+  for(const auto &implicant : level) {
+    buckets[implicant.get_mask()].insert(implicant.get_value());
+  }
+
+  const word all_bits = (numberOfBits >= Implicant::MAX_BITS) ? ~word(0) : ((word(1) << numberOfBits) - 1);
+
+  // Split the level into tiles
+  ThreadPool &pool = ThreadPool::shared();
+  size_t workers = (thread_count == 0) ? pool.size() : std::min(thread_count, pool.size());
+  size_t tile_count = 1;
+  if (workers > 1 && level.size() >= PARALLEL_THRESHOLD) {
+    tile_count = std::min(workers * 4, level.size() / (PARALLEL_THRESHOLD / 4));
+  }
+  size_t tile_size = (level.size() + tile_count - 1) / tile_count;
+  vector<vector<Implicant>> tile_output(tile_count);
+
+  auto run_tile = [&](size_t tile) {
+    size_t lo = tile * tile_size;
+    size_t hi = std::min(level.size(), lo + tile_size);
+    vector<Implicant> &out = tile_output[tile];
+
+    for(size_t i = lo; i < hi; i++) {
+      const word value = level[i].get_value();
+      const word mask = level[i].get_mask();
+      const auto &bucket = buckets.find(mask)->second;
+
+      // Probe for the partner with each free 0-bit set; the lower side emits the combination
+      word free_bits = ~(value | mask) & all_bits;
+      while(free_bits) {
+        word bit = free_bits & (~free_bits + 1);
+        free_bits ^= bit;
+        if (bucket.count(value | bit)) {
+          used[i] = 1;
+          out.emplace_back(value, mask | bit, numberOfBits);
+        }
+      }
+
+      // Probe for the partner with each 1-bit cleared; only marks usage
+      word one_bits = value;
+      while(one_bits && !used[i]) {
+        word bit = one_bits & (~one_bits + 1);
+        one_bits ^= bit;
+        if (bucket.count(value ^ bit)) {
+          used[i] = 1;
+        }
+      }
+    }
+  };
+
+  if (tile_count == 1) {
+    run_tile(0);
+  } else {
+    pool.parallel_for(tile_count, run_tile, workers);
+  }
+
+  // Deterministic merge: tiles in order, first occurrence wins
+  unordered_set<Implicant, ImplicantHash> produced;
+  for(const auto &out : tile_output) {
+    for(const auto &combined : out) {
+      if (produced.insert(combined).second) {
+        next.push_back(combined);
+      }
+    }
+  }
+
+  return !next.empty();
+}
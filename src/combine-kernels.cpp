@@ -0,0 +1,242 @@
+#include "../include/combine-kernels.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define QM_X86_KERNELS 1
+#include <immintrin.h>
+#else
+#define QM_X86_KERNELS 0
+#endif
+
+namespace combine_kernels {
+
+  size_t find_neighbors_scalar(word value, word mask, const word *values, const word *masks,
+                               size_t count, uint32_t *hits) {
+    size_t found = 0;
+    for(size_t k = 0; k < count; k++) {
+      word diff = values[k] ^ value;
+      if (masks[k] == mask && diff != 0 && (diff & (diff - 1)) == 0) {
+        hits[found++] = static_cast<uint32_t>(k);
+      }
+    }
+    return found;
+  }
+
+  // Linear probe for one point
+  static bool lookup(const word *slots, int bits, word point) {
+    size_t last = (size_t(1) << bits) - 1;
+    for(size_t slot = probe_slot(point, bits); ; slot = (slot + 1) & last) {
+      if (slots[slot] == point) return true;
+      if (slots[slot] == EMPTY_SLOT) return false;
+    }
+  }
+
+  bool contains_all_scalar(const word *slots, int bits, const word *points, size_t count) {
+    for(size_t k = 0; k < count; k++) {
+      if (!lookup(slots, bits, points[k])) return false;
+    }
+    return true;
+  }
+
+#if QM_X86_KERNELS
+
+  __attribute__((target("avx2")))
+  size_t find_neighbors_avx2(word value, word mask, const word *values, const word *masks,
+                             size_t count, uint32_t *hits) {
+    const __m256i v = _mm256_set1_epi64x(static_cast<long long>(value));
+    const __m256i m = _mm256_set1_epi64x(static_cast<long long>(mask));
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi64x(1);
+
+    size_t found = 0;
+    size_t k = 0;
+    for(; k + 4 <= count; k += 4) {
+      __m256i cand_v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + k));
+      __m256i cand_m = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(masks + k));
+
+      // Same mask, non-zero XOR, and XOR & (XOR - 1) == 0
+      __m256i diff = _mm256_xor_si256(cand_v, v);
+      __m256i same_mask = _mm256_cmpeq_epi64(cand_m, m);
+      __m256i is_zero = _mm256_cmpeq_epi64(diff, zero);
+      __m256i single = _mm256_cmpeq_epi64(_mm256_and_si256(diff, _mm256_sub_epi64(diff, one)), zero);
+      __m256i hit = _mm256_andnot_si256(is_zero, _mm256_and_si256(same_mask, single));
+
+      unsigned bits = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(hit)));
+      while(bits) {
+        hits[found++] = static_cast<uint32_t>(k + __builtin_ctz(bits));
+        bits &= bits - 1;
+      }
+    }
+
+    // Tail
+    size_t before_tail = found;
+    found += find_neighbors_scalar(value, mask, values + k, masks + k, count - k, hits + found);
+    for(size_t t = before_tail; t < found; t++) {
+      hits[t] += static_cast<uint32_t>(k);
+    }
+    return found;
+  }
+
+  __attribute__((target("avx512f")))
+  size_t find_neighbors_avx512(word value, word mask, const word *values, const word *masks,
+                               size_t count, uint32_t *hits) {
+    const __m512i v = _mm512_set1_epi64(static_cast<long long>(value));
+    const __m512i m = _mm512_set1_epi64(static_cast<long long>(mask));
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i one = _mm512_set1_epi64(1);
+
+    size_t found = 0;
+    size_t k = 0;
+    for(; k + 8 <= count; k += 8) {
+      __m512i cand_v = _mm512_loadu_si512(values + k);
+      __m512i cand_m = _mm512_loadu_si512(masks + k);
+
+      __m512i diff = _mm512_xor_si512(cand_v, v);
+      __mmask8 hit = _mm512_cmpeq_epi64_mask(cand_m, m);
+      hit &= _mm512_cmpneq_epi64_mask(diff, zero);
+      hit &= _mm512_cmpeq_epi64_mask(_mm512_and_si512(diff, _mm512_sub_epi64(diff, one)), zero);
+
+      unsigned bits = static_cast<unsigned>(hit);
+      while(bits) {
+        hits[found++] = static_cast<uint32_t>(k + __builtin_ctz(bits));
+        bits &= bits - 1;
+      }
+    }
+
+    // Tail
+    size_t before_tail = found;
+    found += find_neighbors_scalar(value, mask, values + k, masks + k, count - k, hits + found);
+    for(size_t t = before_tail; t < found; t++) {
+      hits[t] += static_cast<uint32_t>(k);
+    }
+    return found;
+  }
+
+  __attribute__((target("avx2")))
+  bool contains_all_avx2(const word *slots, int bits, const word *points, size_t count) {
+    const __m256i low = _mm256_set1_epi64x(0xFFFFFFFFLL);
+    const __m256i golden = _mm256_set1_epi64x(0x9E3779B1LL);
+    const __m256i empty = _mm256_set1_epi64x(-1);
+    const __m128i shift = _mm_cvtsi32_si128(32 - bits);
+
+    size_t k = 0;
+    for(; k + 4 <= count; k += 4) {
+      __m256i point = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(points + k));
+
+      // probe_slot on 4 lanes, then one gather of the home slots
+      __m256i key = _mm256_xor_si256(point, _mm256_srli_epi64(point, 32));
+      __m256i slot = _mm256_srl_epi64(_mm256_and_si256(_mm256_mul_epu32(key, golden), low), shift);
+      __m256i found = _mm256_i64gather_epi64(reinterpret_cast<const long long*>(slots), slot, 8);
+
+      unsigned miss = ~static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(found, point)))) & 0xF;
+      if (miss == 0) continue;
+
+      // An empty home slot means the point is absent; any other lane keeps probing
+      unsigned vacant = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(found, empty))));
+      if (miss & vacant) return false;
+      for(; miss; miss &= miss - 1) {
+        if (!lookup(slots, bits, points[k + __builtin_ctz(miss)])) return false;
+      }
+    }
+    return contains_all_scalar(slots, bits, points + k, count - k);
+  }
+
+  __attribute__((target("avx512f")))
+  bool contains_all_avx512(const word *slots, int bits, const word *points, size_t count) {
+    const __m512i low = _mm512_set1_epi64(0xFFFFFFFFLL);
+    const __m512i golden = _mm512_set1_epi64(0x9E3779B1LL);
+    const __m512i empty = _mm512_set1_epi64(-1);
+    const __m128i shift = _mm_cvtsi32_si128(32 - bits);
+
+    size_t k = 0;
+    for(; k + 8 <= count; k += 8) {
+      __m512i point = _mm512_loadu_si512(points + k);
+
+      __m512i key = _mm512_xor_si512(point, _mm512_srli_epi64(point, 32));
+      __m512i slot = _mm512_srl_epi64(_mm512_and_si512(_mm512_mul_epu32(key, golden), low), shift);
+      __m512i found = _mm512_i64gather_epi64(slot, slots, 8);
+
+      unsigned miss = static_cast<unsigned>(_mm512_cmpneq_epi64_mask(found, point));
+      if (miss == 0) continue;
+
+      unsigned vacant = static_cast<unsigned>(_mm512_cmpeq_epi64_mask(found, empty));
+      if (miss & vacant) return false;
+      for(; miss; miss &= miss - 1) {
+        if (!lookup(slots, bits, points[k + __builtin_ctz(miss)])) return false;
+      }
+    }
+    return contains_all_scalar(slots, bits, points + k, count - k);
+  }
+
+#else
+
+  bool contains_all_avx2(const word *slots, int bits, const word *points, size_t count) {
+    return contains_all_scalar(slots, bits, points, count);
+  }
+
+  bool contains_all_avx512(const word *slots, int bits, const word *points, size_t count) {
+    return contains_all_scalar(slots, bits, points, count);
+  }
+
+  size_t find_neighbors_avx2(word value, word mask, const word *values, const word *masks,
+                             size_t count, uint32_t *hits) {
+    return find_neighbors_scalar(value, mask, values, masks, count, hits);
+  }
+
+  size_t find_neighbors_avx512(word value, word mask, const word *values, const word *masks,
+                               size_t count, uint32_t *hits) {
+    return find_neighbors_scalar(value, mask, values, masks, count, hits);
+  }
+
+#endif
+
+  bool is_supported(CombineKernel kernel) {
+    switch(kernel) {
+      case CombineKernel::$auto:
+      case CombineKernel::$scalar:
+        return true;
+#if QM_X86_KERNELS
+      case CombineKernel::$avx2:
+        return __builtin_cpu_supports("avx2");
+      case CombineKernel::$avx512:
+        return __builtin_cpu_supports("avx512f");
+#endif
+      default:
+        return false;
+    }
+  }
+
+  // Resolves $auto and unsupported requests to a concrete kernel
+  static CombineKernel resolve(CombineKernel kernel) {
+    if (kernel == CombineKernel::$auto) {
+      if (is_supported(CombineKernel::$avx512)) return CombineKernel::$avx512;
+      if (is_supported(CombineKernel::$avx2)) return CombineKernel::$avx2;
+      return CombineKernel::$scalar;
+    }
+    return is_supported(kernel) ? kernel : CombineKernel::$scalar;
+  }
+
+  KernelFn select(CombineKernel kernel) {
+    switch(resolve(kernel)) {
+      case CombineKernel::$avx512: return find_neighbors_avx512;
+      case CombineKernel::$avx2: return find_neighbors_avx2;
+      default: return find_neighbors_scalar;
+    }
+  }
+
+  ProbeFn select_probe(CombineKernel kernel) {
+    switch(resolve(kernel)) {
+      case CombineKernel::$avx512: return contains_all_avx512;
+      case CombineKernel::$avx2: return contains_all_avx2;
+      default: return contains_all_scalar;
+    }
+  }
+
+  const char* name(CombineKernel kernel) {
+    switch(resolve(kernel)) {
+      case CombineKernel::$avx512: return "avx512";
+      case CombineKernel::$avx2: return "avx2";
+      default: return "scalar";
+    }
+  }
+
+}
@@ -0,0 +1,126 @@
+#include "../include/cover-reduction.h"
+#include <algorithm>
+
+bool CoverReduction::reduce(vector<vector<int>> &rows, const vector<long long> &costs, vector<int> &chosen,
+                            long long &cost, CoverReductionStats *stats, bool pi_dominance) {
+  CoverReductionStats local;
+  CoverReductionStats &counters = stats ? *stats : local;
+
+  for(auto &row : rows) {
+    std::sort(row.begin(), row.end());
+    row.erase(std::unique(row.begin(), row.end()), row.end());
+  }
+
+  bool changed = true;
+  while(changed && !rows.empty()) {
+    changed = false;
+    counters.passes++;
+
+    // Essentials: a minterm with a single PI forces that PI
+    for(const auto &row : rows) {
+      if (row.empty()) return false;
+    }
+    vector<int> forced;
+    for(const auto &row : rows) {
+      if (row.size() == 1) forced.push_back(row[0]);
+    }
+    if (!forced.empty()) {
+      std::sort(forced.begin(), forced.end());
+      forced.erase(std::unique(forced.begin(), forced.end()), forced.end());
+      for(int pi : forced) {
+        chosen.push_back(pi);
+        cost += costs[pi];
+      }
+      counters.secondary_essentials += forced.size();
+      rows.erase(std::remove_if(rows.begin(), rows.end(),
+        [&](const vector<int> &row) {
+          for(int pi : forced) {
+            if (std::binary_search(row.begin(), row.end(), pi)) return true;
+          }
+          return false;
+        }), rows.end());
+      changed = true;
+      continue;
+    }
+
+    // Minterm dominance: covering the smaller PI list covers the larger one for free
+    size_t before = rows.size();
+    std::sort(rows.begin(), rows.end(),
+      [](const vector<int> &r1, const vector<int> &r2) {
+        return r1.size() != r2.size() ? r1.size() < r2.size() : r1 < r2;
+      });
+    rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+    vector<vector<int>> kept;
+    for(auto &row : rows) {
+      bool dominated = false;
+      for(const auto &k : kept) {
+        if (std::includes(row.begin(), row.end(), k.begin(), k.end())) {
+          dominated = true;
+          break;
+        }
+      }
+      if (!dominated) kept.push_back(std::move(row));
+    }
+    rows.swap(kept);
+    counters.dominated_minterms += before - rows.size();
+    if (rows.size() != before) changed = true;
+
+    if (!pi_dominance) continue;
+
+    // PI dominance: a PI whose minterms are a subset of another PI's at no lower cost can go
+    vector<vector<int>> pi_rows(costs.size());
+    vector<int> pis;
+    for(int r = 0; r < int(rows.size()); r++) {
+      for(int pi : rows[r]) {
+        if (pi_rows[pi].empty()) pis.push_back(pi);
+        pi_rows[pi].push_back(r);
+      }
+    }
+    std::sort(pis.begin(), pis.end());
+
+    vector<bool> removed(costs.size(), false);
+    size_t removed_count = 0;
+    for(int p1 : pis) {
+      for(int p2 : pis) {
+        if (p1 == p2 || removed[p2]) continue;
+        if (costs[p2] > costs[p1]) continue;
+        if (!std::includes(pi_rows[p2].begin(), pi_rows[p2].end(), pi_rows[p1].begin(), pi_rows[p1].end())) continue;
+
+        // Same minterms at the same cost: keep the lower index
+        bool same = pi_rows[p1].size() == pi_rows[p2].size() && costs[p1] == costs[p2];
+        if (same && p1 < p2) continue;
+
+        removed[p1] = true;
+        removed_count++;
+        break;
+      }
+    }
+
+    if (removed_count > 0) {
+      for(auto &row : rows) {
+        row.erase(std::remove_if(row.begin(), row.end(), [&](int pi) { return removed[pi]; }), row.end());
+      }
+      counters.dominated_pis += removed_count;
+      changed = true;
+    }
+  }
+
+  for(const auto &row : rows) {
+    if (row.empty()) return false;
+  }
+
+  // Size of what is left
+  vector<bool> seen(costs.size(), false);
+  counters.core_minterms = rows.size();
+  counters.core_pis = 0;
+  for(const auto &row : rows) {
+    for(int pi : row) {
+      if (!seen[pi]) {
+        seen[pi] = true;
+        counters.core_pis++;
+      }
+    }
+  }
+
+  return true;
+}
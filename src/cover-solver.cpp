@@ -0,0 +1,109 @@
+#include "../include/cover-solver.h"
+#include "../include/cover-reduction.h"
+#include <algorithm>
+#include <climits>
+
+// Constructors
+CoverSolver::CoverSolver(const vector<vector<int>> &_rows, int column_count, const vector<long long> &_costs)
+  : rows(_rows), costs(_costs), best_cost(LLONG_MAX), nodes(0) {
+  if (costs.empty()) {
+    costs.assign(column_count, 1);
+  }
+  for(auto &row : rows) {
+    std::sort(row.begin(), row.end());
+    row.erase(std::unique(row.begin(), row.end()), row.end());
+  }
+}
+
+vector<int> CoverSolver::solve() {
+  best.clear();
+  best_cost = LLONG_MAX;
+  nodes = 0;
+
+  search(rows, {}, 0);
+
+  std::sort(best.begin(), best.end());
+  return best;
+}
+
+bool CoverSolver::reduce(vector<vector<int>> &matrix, vector<int> &chosen, long long &cost) const {
+  return CoverReduction::reduce(matrix, costs, chosen, cost);
+}
+
+long long CoverSolver::lower_bound(const vector<vector<int>> &matrix) const {
+  // Greedy maximal independent set of rows, shortest rows first
+  vector<const vector<int>*> order;
+  for(const auto &row : matrix) order.push_back(&row);
+  std::stable_sort(order.begin(), order.end(),
+    [](const vector<int> *r1, const vector<int> *r2) { return r1->size() < r2->size(); });
+
+  vector<bool> taken(costs.size(), false);
+  long long bound = 0;
+  for(const auto *row : order) {
+    bool independent = true;
+    for(int col : *row) {
+      if (taken[col]) {
+        independent = false;
+        break;
+      }
+    }
+    if (!independent) continue;
+
+    // Each independent row needs a distinct column; count its cheapest one
+    long long cheapest = LLONG_MAX;
+    for(int col : *row) {
+      taken[col] = true;
+      cheapest = std::min(cheapest, costs[col]);
+    }
+    bound += cheapest;
+  }
+
+  return bound;
+}
+
+void CoverSolver::search(vector<vector<int>> matrix, vector<int> chosen, long long cost) {
+  nodes++;
+
+  if (!reduce(matrix, chosen, cost)) return;
+  if (cost >= best_cost) return;
+
+  if (matrix.empty()) {
+    best = chosen;
+    best_cost = cost;
+    return;
+  }
+
+  if (cost + lower_bound(matrix) >= best_cost) return;
+
+  // Branch on the column covering the most rows per unit cost
+  vector<int> count(costs.size(), 0);
+  for(const auto &row : matrix) {
+    for(int col : row) count[col]++;
+  }
+  int pick = -1;
+  for(int col = 0; col < int(costs.size()); col++) {
+    if (count[col] == 0) continue;
+    if (pick < 0 || count[col] * costs[pick] > count[pick] * costs[col]) pick = col;
+  }
+
+  // Include the column
+  {
+    vector<vector<int>> included;
+    for(const auto &row : matrix) {
+      if (!std::binary_search(row.begin(), row.end(), pick)) included.push_back(row);
+    }
+    vector<int> with_pick(chosen);
+    with_pick.push_back(pick);
+    search(std::move(included), std::move(with_pick), cost + costs[pick]);
+  }
+
+  // Exclude the column
+  for(auto &row : matrix) {
+    auto it = std::lower_bound(row.begin(), row.end(), pick);
+    if (it != row.end() && *it == pick) {
+      row.erase(it);
+      if (row.empty()) return;
+    }
+  }
+  search(std::move(matrix), std::move(chosen), cost);
+}
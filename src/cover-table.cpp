@@ -0,0 +1,82 @@
+#include "../include/cover-table.h"
+
+namespace cover_table {
+
+  void encode(const vector<Implicant> &primes, const vector<bool> &essentials,
+              const vector<vector<int>> &solutions, vector<unsigned char> &out) {
+    out.push_back(static_cast<unsigned char>(primes.size()));
+    for(const auto &pi : primes) {
+      out.push_back(static_cast<unsigned char>(pi.get_value() | (pi.get_mask() << 4)));
+    }
+
+    auto put_mask = [&](uint32_t mask) {
+      for(int b = 0; b < 4; b++) out.push_back(static_cast<unsigned char>(mask >> (8 * b)));
+    };
+
+    uint32_t epi_mask = 0;
+    for(size_t i = 0; i < primes.size(); i++) {
+      if (essentials[i]) epi_mask |= uint32_t(1) << i;
+    }
+    put_mask(epi_mask);
+
+    out.push_back(static_cast<unsigned char>(solutions.size() & 0xFF));
+    out.push_back(static_cast<unsigned char>(solutions.size() >> 8));
+    for(const auto &solution : solutions) {
+      uint32_t mask = 0;
+      for(int idx : solution) mask |= uint32_t(1) << idx;
+      put_mask(mask);
+    }
+  }
+
+  void decode(const unsigned char *at, int variables, vector<Implicant> &primes,
+              vector<bool> &essentials, vector<vector<int>> &solutions) {
+    auto get_mask = [&]() {
+      uint32_t mask = uint32_t(at[0]) | (uint32_t(at[1]) << 8) | (uint32_t(at[2]) << 16) | (uint32_t(at[3]) << 24);
+      at += 4;
+      return mask;
+    };
+
+    size_t pi_count = *at++;
+    primes.clear();
+    for(size_t i = 0; i < pi_count; i++, at++) {
+      primes.emplace_back(Implicant::word(*at & 0x0F), Implicant::word(*at >> 4), variables);
+    }
+
+    uint32_t epi_mask = get_mask();
+    essentials.assign(pi_count, false);
+    for(size_t i = 0; i < pi_count; i++) essentials[i] = (epi_mask >> i) & 1;
+
+    size_t solution_count = size_t(at[0]) | (size_t(at[1]) << 8);
+    at += 2;
+    solutions.assign(solution_count, {});
+    for(auto &solution : solutions) {
+      uint32_t mask = get_mask();
+      // Non-essential PIs first, then the EPIs
+      for(uint32_t part : {mask & ~epi_mask, mask & epi_mask}) {
+        while(part) {
+          solution.push_back(__builtin_ctz(part));
+          part &= part - 1;
+        }
+      }
+    }
+  }
+
+#ifdef QM_NO_COVER_TABLE
+
+  // The generator is built without a table
+  bool lookup(int, uint32_t, vector<Implicant>&, vector<bool>&, vector<vector<int>>&) {
+    return false;
+  }
+
+#else
+
+  bool lookup(int variables, uint32_t truth_table, vector<Implicant> &primes,
+              vector<bool> &essentials, vector<vector<int>> &solutions) {
+    if (variables < 1 || variables > MAX_VARIABLES) return false;
+    decode(DATA + OFFSETS[first_entry(variables) + truth_table], variables, primes, essentials, solutions);
+    return true;
+  }
+
+#endif
+
+}
@@ -0,0 +1,155 @@
+#include "../include/coverage-table.h"
+#include "../include/term-set.h"
+#include <algorithm>
+
+CoverageTable::CoverageTable(const vector<Implicant> &pe, const vector<Term> &_minterms)
+  : minterms(_minterms), pis(pe.size()) {
+  std::sort(minterms.begin(), minterms.end());
+  minterms.erase(std::unique(minterms.begin(), minterms.end()), minterms.end());
+
+  minterm_words = (minterms.size() + 63) / 64;
+  by_pi.assign(pis * minterm_words, 0);
+
+  // Row of a term when the minterms are dense enough for a bitmap of the space: the bitmap word
+  // holding the term, plus the number of minterms before that word
+  int bits = minterms.empty() ? 0 : 64 - __builtin_clzll(minterms.back() | 1);
+  bool indexed = TermSet::fits_dense(bits, minterms.size());
+  vector<uint64_t> present;
+  vector<uint32_t> before;
+  if (indexed) {
+    present.assign(TermSet::bitmap_words(bits), 0);
+    before.assign(present.size(), 0);
+    for(Term term : minterms) present[term >> 6] |= uint64_t(1) << (term & 63);
+    for(size_t w = 1; w < present.size(); w++) {
+      before[w] = before[w - 1] + static_cast<uint32_t>(__builtin_popcountll(present[w - 1]));
+    }
+  }
+
+  for(size_t pi = 0; pi < pis; pi++) {
+    uint64_t *row_bits = &by_pi[pi * minterm_words];
+    auto mark = [&](size_t row) { row_bits[row >> 6] |= uint64_t(1) << (row & 63); };
+    auto terms = pe[pi].get_covered_terms();
+    if (terms.size() < minterms.size() && indexed) {
+      // Small cube: each covered term is one bitmap probe away from its row
+      for(Term term : terms) {
+        if ((term >> 6) >= present.size()) break;
+        uint64_t word = present[term >> 6];
+        uint64_t below = (uint64_t(1) << (term & 63)) - 1;
+        if ((word >> (term & 63)) & 1) mark(before[term >> 6] + __builtin_popcountll(word & below));
+      }
+    } else if (terms.size() < minterms.size()) {
+      // Small cube over sparse minterms: the covered terms ascend, so each search starts at the last hit
+      auto from = minterms.begin();
+      for(Term term : terms) {
+        from = std::lower_bound(from, minterms.end(), term);
+        if (from == minterms.end()) break;
+        if (*from == term) mark(from - minterms.begin());
+      }
+    } else {
+      // Large cube: test each minterm against it
+      for(size_t row = 0; row < minterms.size(); row++) {
+        if (terms.contains(minterms[row])) mark(row);
+      }
+    }
+  }
+}
+
+size_t CoverageTable::cover_count(size_t row) const {
+  size_t count = 0;
+  for(size_t pi = 0; pi < pis; pi++) count += covers(pi, row);
+  return count;
+}
+
+vector<int> CoverageTable::pis_covering(size_t row) const {
+  vector<int> result;
+  for(size_t pi = 0; pi < pis; pi++) {
+    if (covers(pi, row)) result.push_back(static_cast<int>(pi));
+  }
+  return result;
+}
+
+vector<vector<int>> CoverageTable::pis_covering(const vector<int> &rows) const {
+  // Mark the wanted rows, then walk the PI rows and file each PI under the rows it hits
+  vector<uint64_t> wanted(minterm_words, 0);
+  vector<int> slot(minterms.size(), -1);
+  for(size_t i = 0; i < rows.size(); i++) {
+    wanted[rows[i] >> 6] |= uint64_t(1) << (rows[i] & 63);
+    slot[rows[i]] = static_cast<int>(i);
+  }
+
+  // A block of TILE_WORDS words at a time, so the clauses being filled stay in cache
+  const size_t TILE_WORDS = 4;
+  vector<vector<int>> result(rows.size());
+  for(size_t tile = 0; tile < minterm_words; tile += TILE_WORDS) {
+    size_t stop = std::min(minterm_words, tile + TILE_WORDS);
+    for(size_t pi = 0; pi < pis; pi++) {
+      const uint64_t *bits = &by_pi[pi * minterm_words];
+      for(size_t w = tile; w < stop; w++) {
+        uint64_t word = bits[w] & wanted[w];
+        while(word) {
+          result[slot[w * 64 + __builtin_ctzll(word)]].push_back(static_cast<int>(pi));
+          word &= word - 1;
+        }
+      }
+    }
+  }
+  return result;
+}
+
+vector<int> CoverageTable::rows_covered_by(size_t pi) const {
+  vector<int> result;
+  const uint64_t *bits = &by_pi[pi * minterm_words];
+  for(size_t w = 0; w < minterm_words; w++) {
+    uint64_t word = bits[w];
+    while(word) {
+      result.push_back(static_cast<int>(w * 64 + __builtin_ctzll(word)));
+      word &= word - 1;
+    }
+  }
+  return result;
+}
+
+vector<bool> CoverageTable::essential_pis() const {
+  // Word-parallel count to two: once holds the rows seen at least once, twice at least twice
+  vector<uint64_t> once(minterm_words, 0), twice(minterm_words, 0);
+  for(size_t pi = 0; pi < pis; pi++) {
+    const uint64_t *bits = &by_pi[pi * minterm_words];
+    for(size_t w = 0; w < minterm_words; w++) {
+      twice[w] |= once[w] & bits[w];
+      once[w] |= bits[w];
+    }
+  }
+
+  // A PI is essential if it covers a row no other PI covers
+  vector<bool> essential(pis, false);
+  for(size_t w = 0; w < minterm_words; w++) once[w] &= ~twice[w];
+  for(size_t pi = 0; pi < pis; pi++) {
+    const uint64_t *bits = &by_pi[pi * minterm_words];
+    for(size_t w = 0; w < minterm_words && !essential[pi]; w++) {
+      if (bits[w] & once[w]) essential[pi] = true;
+    }
+  }
+  return essential;
+}
+
+vector<int> CoverageTable::uncovered_rows(const vector<bool> &selected) const {
+  // OR the minterm rows of the selected PIs, then list the zero bits
+  vector<uint64_t> covered(minterm_words, 0);
+  for(size_t pi = 0; pi < pis && pi < selected.size(); pi++) {
+    if (!selected[pi]) continue;
+    const uint64_t *bits = &by_pi[pi * minterm_words];
+    for(size_t w = 0; w < minterm_words; w++) covered[w] |= bits[w];
+  }
+
+  vector<int> result;
+  for(size_t row = 0; row < minterms.size(); row++) {
+    if (!((covered[row >> 6] >> (row & 63)) & 1)) result.push_back(static_cast<int>(row));
+  }
+  return result;
+}
+
+vector<Term> CoverageTable::uncovered_minterms(const vector<bool> &selected) const {
+  vector<Term> result;
+  for(int row : uncovered_rows(selected)) result.push_back(minterms[row]);
+  return result;
+}
@@ -0,0 +1,88 @@
+#include "../include/cube-cover.h"
+#include <algorithm>
+
+namespace cube_cover {
+
+  bool intersect(const Implicant &a, const Implicant &b, Implicant &result) {
+    // Disjoint when some bit is fixed in both with different values
+    if ((a.get_value() ^ b.get_value()) & ~a.get_mask() & ~b.get_mask()) return false;
+    result = Implicant(a.get_value() | b.get_value(), a.get_mask() & b.get_mask(), a.get_number_of_bits());
+    return true;
+  }
+
+  bool cofactor(const Implicant &cube, int bit, bool value, Implicant &result) {
+    word b = word(1) << bit;
+    if (!(cube.get_mask() & b) && ((cube.get_value() & b) != 0) != value) return false;
+    result = Implicant(cube.get_value() & ~b, cube.get_mask() | b, cube.get_number_of_bits());
+    return true;
+  }
+
+  void cofactor(const vector<Implicant> &cover, int bit, bool value, vector<Implicant> &result) {
+    result.clear();
+    result.reserve(cover.size());
+    Implicant cube = Implicant(word(0), word(0), 0);
+    for(const auto &c : cover) {
+      if (cofactor(c, bit, value, cube)) result.push_back(cube);
+    }
+  }
+
+  void remove_contained(vector<Implicant> &cover) {
+    // Larger cubes first; equal cubes end up next to each other
+    std::sort(cover.begin(), cover.end(), [](const Implicant &a, const Implicant &b) {
+      if (a.get_dash_count() != b.get_dash_count()) return a.get_dash_count() > b.get_dash_count();
+      return a < b;
+    });
+
+    // A cube can only lie in a strictly larger one or be a duplicate of the previous one
+    vector<Implicant> kept;
+    kept.reserve(cover.size());
+    size_t larger = 0; // kept[0 .. larger - 1] have more dashes than the current cube
+    for(const auto &cube : cover) {
+      if (!kept.empty() && kept.back() == cube) continue;
+      while(larger < kept.size() && kept[larger].get_dash_count() > cube.get_dash_count()) larger++;
+
+      bool covered = false;
+      for(size_t k = 0; k < larger && !covered; k++) {
+        covered = contains(kept[k], cube);
+      }
+      if (!covered) kept.push_back(cube);
+    }
+    cover.swap(kept);
+  }
+
+  word binate_bits(const vector<Implicant> &cover) {
+    word positive = 0, negative = 0;
+    for(const auto &cube : cover) {
+      positive |= cube.get_value();
+      negative |= ~cube.get_value() & ~cube.get_mask();
+    }
+    return positive & negative;
+  }
+
+  int most_binate_bit(const vector<Implicant> &cover) {
+    word binate = binate_bits(cover);
+    if (binate == 0) return -1;
+
+    int best = -1;
+    size_t best_literals = 0, best_balance = 0;
+    for(word rest = binate; rest; rest &= rest - 1) {
+      int bit = __builtin_ctzll(rest);
+      word b = word(1) << bit;
+      size_t ones = 0, zeros = 0;
+      for(const auto &cube : cover) {
+        if (cube.get_mask() & b) continue;
+        if (cube.get_value() & b) ones++;
+        else zeros++;
+      }
+      size_t literals = ones + zeros;
+      size_t balance = std::min(ones, zeros);
+      if (best < 0 || literals > best_literals || (literals == best_literals && balance > best_balance)) {
+        best = bit;
+        best_literals = literals;
+        best_balance = balance;
+      }
+    }
+    return best;
+  }
+
+}
@@ -0,0 +1,264 @@
+#include "../include/espresso-minimizer.h"
+#include "../include/cube-cover.h"
+#include <algorithm>
+
+// Constructors
+EspressoMinimizer::EspressoMinimizer(const Expression &expression, size_t _max_iterations)
+  : numberOfBits(expression.numberOfBits), max_iterations(std::max<size_t>(_max_iterations, 1)) {
+  on = expression.minterms;
+  std::sort(on.begin(), on.end());
+  on.erase(std::unique(on.begin(), on.end()), on.end());
+
+  care.reserve((on.size() + expression.dontcares.size()) * 2);
+  care.insert(on.begin(), on.end());
+  care.insert(expression.dontcares.begin(), expression.dontcares.end());
+
+  on_index.reserve(on.size() * 2);
+  for(size_t i = 0; i < on.size(); i++) on_index.emplace(on[i], i);
+}
+
+bool EspressoMinimizer::in_care(word value, word mask) const {
+  for(word sub = mask; ; sub = (sub - 1) & mask) {
+    if (!care.count(value | sub)) return false;
+    if (sub == 0) return true;
+  }
+}
+
+EspressoMinimizer::word EspressoMinimizer::free_bits(Term term) const {
+  word bits = 0;
+  for(int i = 0; i < numberOfBits; i++) {
+    if (care.count(term ^ (word(1) << i))) bits |= word(1) << i;
+  }
+  return bits;
+}
+
+vector<uint32_t> EspressoMinimizer::coverage_counts(const vector<Implicant> &cover) const {
+  vector<uint32_t> count(on.size(), 0);
+  for(const auto &cube : cover) {
+    for_each_minterm(cube, [&](size_t i) { count[i]++; });
+  }
+  return count;
+}
+
+size_t EspressoMinimizer::literal_count(const vector<Implicant> &cover) const {
+  size_t literals = 0;
+  for(const auto &cube : cover) literals += numberOfBits - cube.get_dash_count();
+  return literals;
+}
+
+void EspressoMinimizer::expand(vector<Implicant> &cover) const {
+  // Column counts: how many cubes have a 0 / a 1 literal on each bit
+  vector<size_t> zeros(numberOfBits, 0), ones(numberOfBits, 0);
+  for(const auto &cube : cover) {
+    for(int i = 0; i < numberOfBits; i++) {
+      word bit = word(1) << i;
+      if (cube.get_mask() & bit) continue;
+      (cube.get_value() & bit ? ones : zeros)[i]++;
+    }
+  }
+
+  // Largest cubes first, so the small ones they swallow are never expanded
+  vector<size_t> order(cover.size());
+  for(size_t i = 0; i < order.size(); i++) order[i] = i;
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    if (cover[a].get_dash_count() != cover[b].get_dash_count()) return cover[a].get_dash_count() > cover[b].get_dash_count();
+    return cover[a] < cover[b];
+  });
+
+  // Cubes keyed by their lowest point: a cube lies in another when its lowest point does and
+  // its dashes are a subset
+  vector<std::pair<word, size_t>> by_value(cover.size());
+  for(size_t i = 0; i < cover.size(); i++) by_value[i] = {cover[i].get_value(), i};
+  std::sort(by_value.begin(), by_value.end());
+
+  vector<uint8_t> covered(cover.size(), 0);
+  vector<Implicant> result;
+  vector<int> candidates;
+  for(size_t idx : order) {
+    if (covered[idx]) continue;
+    word value = cover[idx].get_value();
+    word mask = cover[idx].get_mask();
+
+    // Raise literals toward the side most other cubes are on; a raise that fails now fails for
+    // every larger cube too, so each literal is tried once
+    candidates.clear();
+    for(int i = 0; i < numberOfBits; i++) {
+      if (!(mask & (word(1) << i))) candidates.push_back(i);
+    }
+    auto score = [&](int i) { return (value & (word(1) << i)) ? zeros[i] : ones[i]; };
+    std::stable_sort(candidates.begin(), candidates.end(), [&](int a, int b) { return score(a) > score(b); });
+    for(int i : candidates) {
+      word bit = word(1) << i;
+      if (in_care(value ^ bit, mask)) {
+        value &= ~bit;
+        mask |= bit;
+      }
+    }
+
+    Implicant expanded(value, mask, numberOfBits);
+    result.push_back(expanded);
+    covered[idx] = 1;
+
+    // Drop every cube the expanded one contains, visiting its points when there are fewer of
+    // them than cubes
+    int dashes = expanded.get_dash_count();
+    if (dashes < 63 && (size_t(1) << dashes) <= by_value.size()) {
+      for(word sub = mask; ; sub = (sub - 1) & mask) {
+        auto it = std::lower_bound(by_value.begin(), by_value.end(), std::make_pair(value | sub, size_t(0)));
+        for(; it != by_value.end() && it->first == (value | sub); ++it) {
+          if ((cover[it->second].get_mask() & ~mask) == 0) covered[it->second] = 1;
+        }
+        if (sub == 0) break;
+      }
+    } else {
+      for(size_t i = 0; i < cover.size(); i++) {
+        if (!covered[i] && cube_cover::contains(expanded, cover[i])) covered[i] = 1;
+      }
+    }
+  }
+
+  cube_cover::remove_contained(result);
+  cover.swap(result);
+}
+
+void EspressoMinimizer::irredundant(vector<Implicant> &cover) const {
+  vector<uint32_t> count = coverage_counts(cover);
+
+  // Try to drop the cubes with the most literals first
+  vector<size_t> order(cover.size());
+  for(size_t i = 0; i < order.size(); i++) order[i] = i;
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    if (cover[a].get_dash_count() != cover[b].get_dash_count()) return cover[a].get_dash_count() < cover[b].get_dash_count();
+    return cover[a] < cover[b];
+  });
+
+  vector<uint8_t> keep(cover.size(), 1);
+  for(size_t idx : order) {
+    bool redundant = true;
+    for_each_minterm(cover[idx], [&](size_t i) { if (count[i] < 2) redundant = false; });
+    if (redundant) {
+      keep[idx] = 0;
+      for_each_minterm(cover[idx], [&](size_t i) { count[i]--; });
+    }
+  }
+
+  vector<Implicant> result;
+  for(size_t i = 0; i < cover.size(); i++) {
+    if (keep[i]) result.push_back(cover[i]);
+  }
+  cover.swap(result);
+}
+
+void EspressoMinimizer::reduce(vector<Implicant> &cover) const {
+  vector<uint32_t> count = coverage_counts(cover);
+
+  // Largest cubes first: they have the most room to move in the next EXPAND
+  vector<size_t> order(cover.size());
+  for(size_t i = 0; i < order.size(); i++) order[i] = i;
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    if (cover[a].get_dash_count() != cover[b].get_dash_count()) return cover[a].get_dash_count() > cover[b].get_dash_count();
+    return cover[a] < cover[b];
+  });
+
+  vector<uint8_t> keep(cover.size(), 1);
+  for(size_t idx : order) {
+    // Supercube of the minterms only this cube covers
+    word all_ones = ~word(0), any_ones = 0;
+    bool owns = false;
+    for_each_minterm(cover[idx], [&](size_t i) {
+      if (count[i] != 1) return;
+      owns = true;
+      all_ones &= on[i];
+      any_ones |= on[i];
+    });
+
+    if (!owns) {
+      keep[idx] = 0;
+      for_each_minterm(cover[idx], [&](size_t i) { count[i]--; });
+      continue;
+    }
+
+    Implicant reduced(all_ones, any_ones & ~all_ones, numberOfBits);
+    for_each_minterm(cover[idx], [&](size_t i) {
+      if (!reduced.covers(on[i])) count[i]--;
+    });
+    cover[idx] = reduced;
+  }
+
+  vector<Implicant> result;
+  for(size_t i = 0; i < cover.size(); i++) {
+    if (keep[i]) result.push_back(cover[i]);
+  }
+  cover.swap(result);
+}
+
+size_t EspressoMinimizer::lower_bound() const {
+  // Cheapest cube through each minterm: every other variable would need a care neighbor
+  vector<word> free(on.size());
+  vector<size_t> order(on.size());
+  for(size_t i = 0; i < on.size(); i++) {
+    free[i] = free_bits(on[i]);
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return __builtin_popcountll(free[a]) < __builtin_popcountll(free[b]);
+  });
+
+  // Greedy set of minterms no implicant can share, most expensive first
+  vector<size_t> chosen;
+  size_t bound = 0;
+  for(size_t i : order) {
+    bool independent = true;
+    for(size_t j : chosen) {
+      word apart = on[i] ^ on[j];
+      if ((apart & ~(free[i] & free[j])) == 0 && in_care(on[i] & ~apart, apart)) {
+        independent = false;
+        break;
+      }
+    }
+    if (independent) {
+      chosen.push_back(i);
+      bound += numberOfBits - __builtin_popcountll(free[i]);
+    }
+  }
+  return bound;
+}
+
+void EspressoMinimizer::minimize(vector<Implicant> &cover, vector<bool> &essential) {
+  stats = EspressoStats();
+
+  cover.clear();
+  for(Term term : on) cover.emplace_back(term, numberOfBits);
+
+  auto cost = [&](const vector<Implicant> &c) { return std::make_pair(c.size(), literal_count(c)); };
+
+  // First pass, then REDUCE / EXPAND / IRREDUNDANT while it keeps improving
+  expand(cover);
+  irredundant(cover);
+  stats.iterations = 1;
+  vector<Implicant> best = cover;
+  while(stats.iterations < max_iterations) {
+    reduce(cover);
+    expand(cover);
+    irredundant(cover);
+    stats.iterations++;
+    if (cost(cover) >= cost(best)) break;
+    best = cover;
+  }
+
+  cover.swap(best);
+  std::sort(cover.begin(), cover.end());
+
+  // A cube is an essential prime when one of its minterms has no care neighbor outside it
+  essential.assign(cover.size(), false);
+  for(size_t c = 0; c < cover.size(); c++) {
+    const word outside = ~cover[c].get_mask();
+    for_each_minterm(cover[c], [&](size_t i) {
+      if (!essential[c] && (free_bits(on[i]) & outside) == 0) essential[c] = true;
+    });
+  }
+
+  stats.cubes = cover.size();
+  stats.literals = literal_count(cover);
+  stats.lower_bound = lower_bound();
+}
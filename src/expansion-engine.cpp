@@ -0,0 +1,151 @@
+#include "../include/expansion-engine.h"
+#include "../include/thread-pool.h"
+#include <algorithm>
+
+using combine_kernels::EMPTY_SLOT;
+
+// Seed lists smaller than this are expanded on the calling thread
+static const size_t PARALLEL_THRESHOLD = 1024;
+
+// Points of a cube handed to the probe kernel at once
+static const size_t PROBE_BLOCK = 32;
+
+namespace {
+
+  using word = Implicant::word;
+
+  // Read-only state shared by every seed: the care points in an open-addressing table at most half
+  // full, probed by the kernel of ExpansionEngine's CombineKernel
+  struct CareSet {
+    vector<word> slots;
+    int bits = 1;
+    bool has_empty = false; // EMPTY_SLOT itself is a care point (64 variables only)
+    int numberOfBits;
+    combine_kernels::ProbeFn contains_all;
+
+    CareSet(const vector<word> &points, int _numberOfBits, CombineKernel kernel)
+      : numberOfBits(_numberOfBits), contains_all(combine_kernels::select_probe(kernel)) {
+      while((size_t(1) << bits) < points.size() * 2 && bits < 32) bits++;
+      slots.assign(size_t(1) << bits, EMPTY_SLOT);
+      size_t last = slots.size() - 1;
+      for(word point : points) {
+        if (point == EMPTY_SLOT) {
+          has_empty = true;
+          continue;
+        }
+        size_t slot = combine_kernels::probe_slot(point, bits);
+        while(slots[slot] != EMPTY_SLOT) slot = (slot + 1) & last;
+        slots[slot] = point;
+      }
+    }
+
+    // True if the point is a care point
+    bool has(word point) const {
+      if (point == EMPTY_SLOT) return has_empty;
+      return combine_kernels::contains_all_scalar(slots.data(), bits, &point, 1);
+    }
+
+    // True if every point of the cube (value, mask) is a care point
+    bool contains(word value, word mask) const {
+      if ((value | mask) == EMPTY_SLOT && !has_empty) return false;
+      if (mask == 0) return has(value);
+
+      // The points go to the kernel a block at a time, so a missing one still ends the test early
+      word block[PROBE_BLOCK];
+      size_t count = 0;
+      for(word sub = mask; ; sub = (sub - 1) & mask) {
+        block[count++] = value | sub;
+        if (count == PROBE_BLOCK) {
+          if (!contains_all(slots.data(), bits, block, count)) return false;
+          count = 0;
+        }
+        if (sub == 0) break;
+      }
+      return contains_all(slots.data(), bits, block, count);
+    }
+  };
+
+  // Cubes whose lowest point is one seed
+  class SeedExpansion {
+    const CareSet &care;
+    word seed;
+    vector<word> up; // Bits clear in the seed whose neighbor is a care point
+    vector<word> down; // Bits set in the seed whose neighbor is a care point
+    vector<Implicant> &out;
+
+    public:
+    SeedExpansion(const CareSet &_care, word _seed, vector<Implicant> &_out)
+      : care(_care), seed(_seed), out(_out) {
+      for(int i = 0; i < care.numberOfBits; i++) {
+        word bit = word(1) << i;
+        if (care.has(seed ^ bit)) (seed & bit ? down : up).push_back(bit);
+      }
+    }
+
+    // Visits the cube (seed, mask) whose dashes were taken from up[0 .. start - 1]
+    void expand(word mask, size_t start) {
+      bool prime = true;
+
+      // Dashing an up bit brings in the half above the cube; only later bits are branched on
+      for(size_t k = 0; k < up.size(); k++) {
+        if ((mask & up[k]) || !care.contains(seed | up[k], mask)) continue;
+        prime = false;
+        if (k >= start) expand(mask | up[k], k + 1);
+      }
+
+      // Dashing a down bit brings in the half below, which would make a cube with a lower seed
+      for(size_t k = 0; k < down.size() && prime; k++) {
+        if (care.contains(seed ^ down[k], mask)) prime = false;
+      }
+
+      if (prime) out.emplace_back(seed, mask, care.numberOfBits);
+    }
+  };
+
+}
+
+// Constructors
+ExpansionEngine::ExpansionEngine(int _numberOfBits, size_t _thread_count, CombineKernel _kernel)
+  : numberOfBits(_numberOfBits), thread_count(_thread_count), kernel(_kernel) {}
+
+void ExpansionEngine::generate_primes(const vector<Term> &minterms, const vector<Term> &dontcares,
+                                      vector<Implicant> &primes) const {
+  primes.clear();
+
+  // Every care point seeds the cubes that have it as their lowest point
+  vector<word> seeds(minterms.begin(), minterms.end());
+  seeds.insert(seeds.end(), dontcares.begin(), dontcares.end());
+  std::sort(seeds.begin(), seeds.end());
+  seeds.erase(std::unique(seeds.begin(), seeds.end()), seeds.end());
+
+  CareSet care(seeds, numberOfBits, kernel);
+
+  // Split the seeds into tiles
+  ThreadPool &pool = ThreadPool::shared();
+  size_t workers = (thread_count == 0) ? pool.size() : std::min(thread_count, pool.size());
+  size_t tile_count = 1;
+  if (workers > 1 && seeds.size() >= PARALLEL_THRESHOLD) {
+    tile_count = std::min(workers * 4, seeds.size() / (PARALLEL_THRESHOLD / 4));
+  }
+  size_t tile_size = (seeds.size() + tile_count - 1) / tile_count;
+  vector<vector<Implicant>> tile_output(tile_count);
+
+  auto run_tile = [&](size_t tile) {
+    size_t lo = tile * tile_size;
+    size_t hi = std::min(seeds.size(), lo + tile_size);
+    for(size_t i = lo; i < hi; i++) {
+      SeedExpansion(care, seeds[i], tile_output[tile]).expand(0, 0);
+    }
+  };
+
+  if (tile_count == 1) {
+    run_tile(0);
+  } else {
+    pool.parallel_for(tile_count, run_tile, workers);
+  }
+
+  for(const auto &out : tile_output) {
+    primes.insert(primes.end(), out.begin(), out.end());
+  }
+  std::sort(primes.begin(), primes.end());
+}
@@ -1,4 +1,5 @@
 #include "../include/expression.h"
+#include "../include/term-set.h"
 #include <iostream>
 #include <algorithm>
 #include <cassert>
@@ -17,8 +18,8 @@ void Expression::read() {
   cin.ignore(1000, '\n'); // Clear the newline
   
   // Validate number of bits
-  if (numberOfBits <= 0 || numberOfBits > 20) {
-    cout << "Error: Number of bits must be between 1 and 20\n";
+  if (numberOfBits <= 0 || numberOfBits > MAX_BITS) {
+    cout << "Error: Number of bits must be between 1 and " << MAX_BITS << "\n";
     numberOfBits = 3; // Default
   }
   
@@ -29,11 +30,11 @@ void Expression::read() {
   std::istringstream minterm_stream(minterm_line);
   
   minterms.clear();
-  int minterm;
+  long long minterm;
   while (minterm_stream >> minterm) {
     // Validate minterm is within valid range
-    if (minterm >= 0 && minterm < (1 << numberOfBits)) {
-      minterms.push_back(minterm);
+    if (minterm >= 0 && in_range(static_cast<Term>(minterm))) {
+      minterms.push_back(static_cast<Term>(minterm));
     } else {
       cout << "Warning: Minterm " << minterm << " is out of range and will be ignored.\n";
     }
@@ -44,10 +45,6 @@ void Expression::read() {
     minterms.push_back(0);
   }
   
-  // Remove duplicates from minterms
-  std::sort(minterms.begin(), minterms.end());
-  minterms.erase(std::unique(minterms.begin(), minterms.end()), minterms.end());
-  
   // Read don't cares
   cout << "Enter don't cares (space-separated, or press Enter to skip): ";
   string dontcare_line;
@@ -56,29 +53,74 @@ void Expression::read() {
   dontcares.clear();
   if (!dontcare_line.empty()) {
     std::istringstream dontcare_stream(dontcare_line);
-    int dontcare;
+    long long dontcare;
     while (dontcare_stream >> dontcare) {
       // Validate don't care is within valid range
-      if (dontcare >= 0 && dontcare < (1 << numberOfBits)) {
-        dontcares.push_back(dontcare);
+      if (dontcare >= 0 && in_range(static_cast<Term>(dontcare))) {
+        dontcares.push_back(static_cast<Term>(dontcare));
       } else {
         cout << "Warning: Don't care " << dontcare << " is out of range and will be ignored.\n";
       }
     }
-    
-    // Remove duplicates from don't cares
-    std::sort(dontcares.begin(), dontcares.end());
-    dontcares.erase(std::unique(dontcares.begin(), dontcares.end()), dontcares.end());
-    
-    // Remove any don't cares that are also minterms
-    vector<int> filtered_dontcares;
-    for(int dc : dontcares) {
-      if(std::find(minterms.begin(), minterms.end(), dc) == minterms.end()) {
-        filtered_dontcares.push_back(dc);
-      }
-    }
-    dontcares = filtered_dontcares;
   }
+
+  // Remove duplicates and any don't cares that are also minterms
+  canonicalize();
+}
+
+void Expression::canonicalize() {
+  TermSet on(numberOfBits, minterms);
+  on.to_vector(minterms);
+  TermSet(numberOfBits, dontcares).without(on).to_vector(dontcares);
+}
+
+// Listed terms plus the points of the cubes, saturating at SIZE_MAX
+static size_t count_points(size_t listed, const vector<Implicant> &cubes) {
+  size_t count = listed;
+  for(const auto &cube : cubes) {
+    int dashes = cube.get_dash_count();
+    if (dashes >= int(sizeof(size_t) * 8) || count + (size_t(1) << dashes) < count) return SIZE_MAX;
+    count += size_t(1) << dashes;
+  }
+  return count;
+}
+
+size_t Expression::minterm_points() const {
+  return count_points(minterms.size(), minterm_cubes);
+}
+
+size_t Expression::dontcare_points() const {
+  return count_points(dontcares.size(), dontcare_cubes);
+}
+
+size_t Expression::care_count() const {
+  size_t on = minterm_points(), dc = dontcare_points();
+  return (on + dc < on) ? SIZE_MAX : on + dc;
+}
+
+// Appends every point of the cubes to the list
+static void append_points(const vector<Implicant> &cubes, vector<Term> &terms) {
+  for(const auto &cube : cubes) {
+    for(Term term : cube.get_covered_terms()) terms.push_back(term);
+  }
+}
+
+void Expression::expand_cubes(bool dontcares_too) {
+  if (!has_cubes()) return;
+  append_points(minterm_cubes, minterms);
+  minterm_cubes.clear();
+  if (dontcares_too) {
+    append_points(dontcare_cubes, dontcares);
+    dontcare_cubes.clear();
+  }
+}
+
+TermSet Expression::off_set() const {
+  vector<Term> care(minterms);
+  care.insert(care.end(), dontcares.begin(), dontcares.end());
+  append_points(minterm_cubes, care);
+  append_points(dontcare_cubes, care);
+  return TermSet(numberOfBits, care).complement();
 }
 
 bool Expression::evalute(const vector<int>& input) {
@@ -86,12 +128,13 @@ bool Expression::evalute(const vector<int>& input) {
   assert(static_cast<int>(input.size()) == numberOfBits);
   
   // Convert input vector to integer value
-  int value = 0;
+  Term value = 0;
   for(int i = 0; i < numberOfBits; i++) {
     assert(input[i] == 0 || input[i] == 1); // Each input must be 0 or 1
-    value = (value << 1) | input[i];
+    value = (value << 1) | static_cast<Term>(input[i]);
   }
   
   // Check if value is in minterms
-  return std::find(minterms.begin(), minterms.end(), value) != minterms.end();
+  if (std::binary_search(minterms.begin(), minterms.end(), value)) return true;
+  return std::any_of(minterm_cubes.begin(), minterm_cubes.end(), [&](const Implicant &cube) { return cube.covers(value); });
 }
\ No newline at end of file
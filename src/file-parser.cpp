@@ -1,137 +1,260 @@
 #include "../include/file-parser.h"
+#include "../include/term-set.h"
+#include "../utils/mapped_file.h"
 #include <fstream>
-#include <sstream>
 #include <iostream>
 #include <cctype>
+#include <cstring>
+#include <climits>
 #include <algorithm>
+#include <utility>
 
 using namespace std;
 
+// Largest variable count accepted in maxterm form; the complement is expanded term by term
+static const int MAX_MAXTERM_BITS = 20;
+
+// Prints the out-of-range error for a term
+static void report_range(const Expression& expr, Term term) {
+    Term largest = (expr.numberOfBits >= Expression::MAX_BITS) ? ~Term(0) : (Term(1) << expr.numberOfBits) - 1;
+    cerr << "Error: Term " << term << " out of range for " << expr.numberOfBits
+         << " variables (0–" << largest << ").\n";
+}
+
+static bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// Splits the mapped bytes into lines ('\n' separated, the last one may be unterminated)
+struct LineCursor {
+    const char* at;
+    const char* end;
+
+    // [line begin], [line end]; false once the bytes are used up
+    bool next(const char*& begin, const char*& stop) {
+        if (at == end) return false;
+        begin = at;
+        const char* newline = static_cast<const char*>(memchr(at, '\n', end - at));
+        stop = newline ? newline : end;
+        at = newline ? newline + 1 : end;
+        return true;
+    }
+};
+
+// Leading integer of the line, like stoi: leading blanks, an optional sign, then digits. Anything
+// after the digits is ignored.
+static bool scan_int(const char* p, const char* end, int& value) {
+    while (p < end && is_space(*p)) p++;
+    bool negative = false;
+    if (p < end && (*p == '+' || *p == '-')) negative = (*p++ == '-');
+    if (p == end || !isdigit(static_cast<unsigned char>(*p))) return false;
+    long long v = 0;
+    for (; p < end && isdigit(static_cast<unsigned char>(*p)); p++) {
+        v = v * 10 + (*p - '0');
+        if (v > INT_MAX) return false;
+    }
+    value = static_cast<int>(negative ? -v : v);
+    return true;
+}
+
+// Scans a list "<prefix><entry>,<prefix><entry>,..." in place. Blanks are ignored everywhere,
+// commas are optional separators. An entry is a term N, a range A..B (both ends included) or a cube
+// of exactly n characters 0 / 1 / -, the most significant variable first; a dash always means a
+// cube, so an entry reads the same whatever the variable count. Ranges are split into aligned
+// blocks, so every entry reaches term(prefix, value, dashes) as one or more cubes (dashes = 0 for a
+// single term); term may stop the scan by returning false. A term past the variable count or a
+// dashed entry that is not a cube is reported and sets reported. Returns false on a malformed
+// entry (bad prefix, missing digits, overflow, reversed range), a reported one or a stop.
+template<typename F>
+static bool scan_list(const char* p, const char* end, const Expression& expr, bool& reported, F term) {
+    auto skip = [&]() { while (p < end && is_space(*p)) p++; };
+    auto digit = [](char c) { return c >= '0' && c <= '9'; };
+    for (skip(); p < end; skip()) {
+        char prefix = *p++;
+        skip();
+        const char* start = p;
+
+        // A or A..B, read straight from the bytes. Whether it is well formed only matters once the
+        // entry turns out to have no dash.
+        Term bounds[2] = {0, 0};
+        int count = 0;
+        bool malformed = false;
+        while (true) {
+            Term value = 0;
+            bool any = false;
+            for (; p < end && digit(*p); skip()) {
+                unsigned d = *p++ - '0';
+                if (value > (~Term(0) - d) / 10) malformed = true;
+                value = value * 10 + d;
+                any = true;
+            }
+            if (!any || count == 2) {
+                malformed = true;
+                break;
+            }
+            bounds[count++] = value;
+            if (p == end || *p != '.') break;
+            p++;
+            skip();
+            if (p == end || *p != '.') {
+                malformed = true;
+                break;
+            }
+            p++;
+            skip();
+        }
+
+        // Whatever is left of the entry: digits, dashes and dots
+        bool dashed = false;
+        for (; p < end && (digit(*p) || *p == '-' || *p == '.'); skip()) dashed |= (*p++ == '-');
+
+        if (dashed) {
+            // The entry again, from its first byte: one 0 / 1 / - per variable
+            Term value = 0, mask = 0;
+            int width = 0;
+            bool cube = true;
+            for (const char* q = start; q < p; q++) {
+                if (is_space(*q)) continue;
+                cube = cube && (*q == '0' || *q == '1' || *q == '-');
+                value = (value << 1) | Term(*q == '1');
+                mask = (mask << 1) | Term(*q == '-');
+                width++;
+            }
+            if (!cube || width != expr.numberOfBits) {
+                string entry;
+                for (const char* q = start; q < p; q++) {
+                    if (!is_space(*q)) entry += *q;
+                }
+                cerr << "Error: '" << prefix << entry << "' is not a cube of " << expr.numberOfBits
+                     << " variables (one 0, 1 or - per variable; ranges are written A..B).\n";
+                reported = true;
+                return false;
+            }
+            if (!term(prefix, value, mask)) return false;
+        } else {
+            if (malformed) return false;
+            Term low = bounds[0], high = bounds[count - 1];
+            if (low > high) return false;
+            if (!expr.in_range(high)) {
+                report_range(expr, high);
+                reported = true;
+                return false;
+            }
+            // Largest aligned block starting at low that stays within high, until high is reached
+            while (true) {
+                Term mask = 0;
+                for (Term wider = 1; wider != mask && (low & wider) == 0 && (low | wider) <= high; wider = (wider << 1) | 1) {
+                    mask = wider;
+                }
+                if (!term(prefix, low, mask)) return false;
+                if ((low | mask) == high) break;
+                low = (low | mask) + 1;
+            }
+        }
+        if (p < end && *p == ',') p++;
+    }
+    return true;
+}
+
 bool FileParser::parse_file(const string& filename, Expression& expr) {
-    ifstream infile(filename);
-    
-    if (!infile.is_open()) {
+    // The file is read in place; a missing file maps as zero bytes
+    MappedFile file;
+    if (!file.open(filename) || (file.size() == 0 && !ifstream(filename).is_open())) {
         cerr << "Error: Could not open file '" << filename << "'\n";
         return false;
     }
-    
-    string line;
+    LineCursor lines{file.data(), file.data() + file.size()};
+    const char* begin = nullptr;
+    const char* stop = nullptr;
     
     // Line 1: Number of variables
-    if (!getline(infile, line)) {
+    if (!lines.next(begin, stop)) {
         cerr << "Error: Missing number of variables\n";
         return false;
     }
     
-    try {
-        expr.numberOfBits = stoi(line);
-        if (expr.numberOfBits <= 0 || expr.numberOfBits > 20) {
-            cerr << "Error: Number of variables must be between 1 and 20\n";
-            return false;
-        }
-    } catch (...) {
+    if (!scan_int(begin, stop, expr.numberOfBits)) {
         cerr << "Error: Invalid number of variables\n";
         return false;
     }
+    if (expr.numberOfBits <= 0 || expr.numberOfBits > Expression::MAX_BITS) {
+        cerr << "Error: Number of variables must be between 1 and " << Expression::MAX_BITS << "\n";
+        return false;
+    }
     
     // Line 2: Minterms or Maxterms (m1,m3,m6,m7 or M0,M2,M4,M5)
-    if (!getline(infile, line)) {
+    if (!lines.next(begin, stop)) {
         cerr << "Error: Missing minterms/maxterms line\n";
         return false;
     }
     
-    bool is_maxterm = false;
-    if (!parse_terms_line(line, expr.minterms, is_maxterm)) {
+    // The first prefix decides the form. Maxterms go straight into a bitmap of the space, minterms
+    // into the list and minterm cubes into the cube list; every term is range-checked as it is read
+    const char* first = begin;
+    while (first < stop && is_space(*first)) first++;
+    bool is_maxterm = (first < stop && *first == 'M');
+    bool bitmap_form = is_maxterm && expr.numberOfBits <= MAX_MAXTERM_BITS;
+    vector<uint64_t> bitmap(bitmap_form ? TermSet::bitmap_words(expr.numberOfBits) : 0, 0);
+    bool reported = false;
+    expr.minterms.clear();
+    expr.minterm_cubes.clear();
+    bool ok = first < stop && (*first == 'm' || *first == 'M') &&
+              scan_list(begin, stop, expr, reported, [&](char prefix, Term value, Term mask) {
+                  if (prefix != 'm' && prefix != 'M') return false;
+                  if (bitmap_form) {
+                      for (Term sub = mask; ; sub = (sub - 1) & mask) {
+                          Term term = value | sub;
+                          bitmap[term >> 6] |= uint64_t(1) << (term & 63);
+                          if (sub == 0) break;
+                      }
+                  } else if (is_maxterm) {
+                      // Rejected below
+                  } else if (mask == 0) {
+                      expr.minterms.push_back(value);
+                  } else {
+                      expr.minterm_cubes.emplace_back(value, mask, expr.numberOfBits);
+                  }
+                  return true;
+              });
+    if (reported) return false;
+    if (!ok) {
         cerr << "Error: Invalid minterms/maxterms format\n";
         return false;
     }
+
+    // Every minterm is a row of the covering problem, so minterm cubes are expanded later on
+    size_t points = expr.minterm_points();
+    if (points > Expression::MAX_EXPANDED_TERMS) {
+        cerr << "Error: The minterms cover ";
+        if (points == SIZE_MAX) cerr << "more than " << SIZE_MAX;
+        else cerr << points;
+        cerr << " points; at most " << Expression::MAX_EXPANDED_TERMS << " can be minimized\n";
+        return false;
+    }
     
     // Convert maxterms to minterms if needed
     if (is_maxterm) {
-        vector<int> maxterms = expr.minterms;
-        expr.minterms.clear();
-        int max_val = (1 << expr.numberOfBits);
-        for (int i = 0; i < max_val; i++) {
-            if (find(maxterms.begin(), maxterms.end(), i) == maxterms.end()) {
-                expr.minterms.push_back(i);
-            }
+        if (!bitmap_form) {
+            cerr << "Error: Maxterm form is limited to " << MAX_MAXTERM_BITS << " variables; list the minterms instead\n";
+            return false;
         }
+        // The minterms are the complement of the maxterms: a bitmap NOT
+        TermSet::from_bitmap(expr.numberOfBits, std::move(bitmap)).complement().to_vector(expr.minterms);
     }
     
-    // Line 3: Don't cares (d0,d5) - optional
+    // Line 3: Don't cares (d0,d5) - optional; a malformed list is cut at the first bad entry, a
+    // reported one fails the parse
     expr.dontcares.clear();
-    if (getline(infile, line) && !line.empty()) {
-        parse_dontcares_line(line, expr.dontcares);
+    expr.dontcare_cubes.clear();
+    if (lines.next(begin, stop) && begin != stop) {
+        scan_list(begin, stop, expr, reported, [&](char prefix, Term value, Term mask) {
+            if (prefix != 'd' && prefix != 'D') return false;
+            if (mask == 0) expr.dontcares.push_back(value);
+            else expr.dontcare_cubes.emplace_back(value, mask, expr.numberOfBits);
+            return true;
+        });
+        if (reported) return false;
     }
     
-    infile.close();
     return true;
 }
-
-bool FileParser::parse_terms_line(const string& line, vector<int>& terms, bool& is_maxterm) {
-    terms.clear();
-    
-    // Remove whitespace
-    string cleaned;
-    for (char c : line) {
-        if (!isspace(c)) cleaned += c;
-    }
-    
-    if (cleaned.empty()) return false;
-    
-    // Check if minterm (m) or maxterm (M)
-    if (cleaned[0] == 'm' || cleaned[0] == 'M') {
-        is_maxterm = (cleaned[0] == 'M');
-    } else {
-        return false;
-    }
-    
-    // Parse: m1,m3,m6,m7
-    stringstream ss(cleaned);
-    char prefix;
-    int num;
-    char comma;
-    
-    while (ss >> prefix) {
-        if (prefix != 'm' && prefix != 'M') return false;
-        if (!(ss >> num)) return false;
-        terms.push_back(num);
-        
-        // Check for comma
-        if (ss.peek() == ',') {
-            ss >> comma;
-        }
-    }
-    
-    return !terms.empty();
-}
-
-bool FileParser::parse_dontcares_line(const string& line, vector<int>& dontcares) {
-    dontcares.clear();
-    
-    // Remove whitespace
-    string cleaned;
-    for (char c : line) {
-        if (!isspace(c)) cleaned += c;
-    }
-    
-    if (cleaned.empty()) return true; // Empty is valid
-    
-    // Parse: d0,d5
-    stringstream ss(cleaned);
-    char prefix;
-    int num;
-    char comma;
-    
-    while (ss >> prefix) {
-        if (prefix != 'd' && prefix != 'D') return false;
-        if (!(ss >> num)) return false;
-        dontcares.push_back(num);
-        
-        if (ss.peek() == ',') {
-            ss >> comma;
-        }
-    }
-    
-    return true;
-}
\ No newline at end of file
@@ -1,45 +1,43 @@
 #include "../include/implicant.h"
 
-Implicant::Implicant(int value, int _numberOfBits) {
+Implicant::Implicant(word value, int _numberOfBits) {
   // Set number of bits FIRST
   numberOfBits = _numberOfBits;
 
   // validate value (after numberOfBits is set)
-  assert(value >= 0 && value < (1 << numberOfBits));
+  assert(numberOfBits >= 0 && numberOfBits <= MAX_BITS);
+  assert(numberOfBits == MAX_BITS || (value >> numberOfBits) == 0);
 
-  // Add value to the covering set
-  covering.insert(value);
-
-  // Fill bits
-  bits.resize(numberOfBits);
-  for(int idx = numberOfBits - 1; idx >= 0; idx--) {
-    int bit = (value & 1);
-    bits[idx] = (bit == 0 ? ImplicantBit::$zero : ImplicantBit::$one);
-    value >>= 1;
-  }
+  // A single term has no dashes
+  this->value = value;
+  mask = 0;
 }
 
-Implicant::Implicant(const vector<ImplicantBit> &list, set<int> covered_terms) {
+Implicant::Implicant(const vector<ImplicantBit> &list) {
 
   // Set number of bits
   numberOfBits = static_cast<int>(list.size());
 
-  // Fill bits
-  bits = list;
-
-  // Set covering terms
-  for(const int term : covered_terms) {
-    assert(term >= 0 && term < (1 << numberOfBits)); // term must be valid
-    covering.insert(term);
+  // Pack bits; list[0] is the most significant variable
+  value = 0;
+  mask = 0;
+  for(int idx = 0; idx < numberOfBits; idx++) {
+    word bit = word(1) << (numberOfBits - 1 - idx);
+    if (list[idx] == ImplicantBit::$one) value |= bit;
+    else if (list[idx] == ImplicantBit::$dash) mask |= bit;
   }
+}
 
+Implicant::Implicant(word _value, word _mask, int _numberOfBits)
+  : numberOfBits(_numberOfBits), value(_value & ~_mask), mask(_mask) {
+  assert(numberOfBits >= 0 && numberOfBits <= MAX_BITS);
 }
 
 Implicant::Implicant(const Implicant &other) {
   // Copy member variables
   numberOfBits = other.numberOfBits;
-  bits = other.bits;
-  covering = other.covering;
+  value = other.value;
+  mask = other.mask;
 }
 
 // Operator overloading
@@ -47,18 +45,18 @@ Implicant& Implicant::operator=(const Implicant &other) {
   if (this != &other) {
     // Copy member variables
     numberOfBits = other.numberOfBits;
-    bits = other.bits;
-    covering = other.covering;
+    value = other.value;
+    mask = other.mask;
   }
   return *this;
 }
 
 bool Implicant::operator==(const Implicant &other) const {
-  return bits == other.bits;
+  return numberOfBits == other.numberOfBits && value == other.value && mask == other.mask;
 }
 
 bool Implicant::operator!=(const Implicant &other) const {
-  return bits != other.bits;
+  return !(*this == other);
 }
 
 bool Implicant::operator<(const Implicant &other) const {
@@ -66,20 +64,23 @@ bool Implicant::operator<(const Implicant &other) const {
   if (numberOfBits != other.numberOfBits) {
     return numberOfBits < other.numberOfBits;
   }
-  return bits < other.bits;
+
+  // The first differing bit is the highest one set in either difference word
+  word diff = (value ^ other.value) | (mask ^ other.mask);
+  if (diff == 0) return false;
+  word top = word(1) << (63 - __builtin_clzll(diff));
+
+  // Bits order as $zero < $one < $dash
+  if ((mask ^ other.mask) & top) return (other.mask & top) != 0;
+  return (other.value & top) != 0;
 }
 
 int Implicant::operator-(const Implicant &other) const {
   // Both implicants must have the same number of bits
   assert(numberOfBits == other.numberOfBits);
   
-  // Count differing bits
-  int diff_count = 0;
-  for(int idx = 0; idx < numberOfBits; idx++) {
-    diff_count += static_cast<int>(bits[idx] != other.bits[idx]);
-  }
-  
-  return diff_count;
+  // Count differing bits; a dash differs from both $zero and $one
+  return __builtin_popcountll((value ^ other.value) | (mask ^ other.mask));
 }
 
 int Implicant::operator-=(const Implicant &other) {
@@ -93,20 +94,11 @@ Implicant Implicant::operator+(const Implicant &other) const {
   // The two implicants must differ by exactly one bit
   assert((*this - other) == 1);
 
-  // Create new bits vector
-  vector<ImplicantBit> new_bits(numberOfBits);
-  for(int idx = 0; idx < numberOfBits; idx++) {
-    new_bits[idx] = (bits[idx] == other.bits[idx] ? bits[idx] : ImplicantBit::$dash);
-  }
-
-  // Create new implicant
-  Implicant new_implicant(new_bits);
+  // The differing bit becomes a dash
+  word new_mask = mask | (value ^ other.value) | (mask ^ other.mask);
 
-  // Merge covering sets
-  new_implicant.covering.insert(covering.begin(), covering.end());
-  new_implicant.covering.insert(other.covering.begin(), other.covering.end());
-
-  return new_implicant;
+  // Coverage follows from the new mask, so nothing else needs merging
+  return Implicant(value, new_mask, numberOfBits);
 }
 
 Implicant& Implicant::operator+=(const Implicant &other) {
@@ -122,28 +114,28 @@ int Implicant::get_number_of_bits() const {
 ImplicantBit Implicant::get_bit(int index) const {
   if (index < 0 || index >= numberOfBits)
     throw std::out_of_range("Index out of range in get_bit()");
-  return bits[index];
-}
-
-vector<int> Implicant::get_covered_terms() const {
-  return vector<int>(covering.begin(), covering.end());
+  word bit = word(1) << (numberOfBits - 1 - index);
+  if (mask & bit) return ImplicantBit::$dash;
+  return (value & bit) ? ImplicantBit::$one : ImplicantBit::$zero;
 }
 
 // Helper
 vector<pair<int, bool>> Implicant::generate_product() const {
   vector<pair<int, bool>> sop;
   for(int idx = 0; idx < numberOfBits; idx++) {
+    word bit = word(1) << (numberOfBits - 1 - idx);
+
+    // Dashes do not appear in the SOP
+    if (mask & bit) continue;
 
-    // If the bit is not a dash, include it in the SOP
-    if (bits[idx] == ImplicantBit::$one) {
-      sop.emplace_back(idx, false);
-    } 
-    
-    // If the bit is zero, include it as negated in the SOP
-    else if (bits[idx] == ImplicantBit::$zero) {
-      sop.emplace_back(idx, true);
-    }
+    // Ones appear as plain literals, zeros as negated literals
+    sop.emplace_back(idx, (value & bit) == 0);
   }
 
   return sop;
+}
+
+string Implicant::variable_name(int index) {
+  if (index < 26) return string(1, static_cast<char>('A' + index));
+  return "x" + std::to_string(index);
 }
\ No newline at end of file
@@ -1,7 +1,84 @@
 #include "quine-mccluskey-driver.h"
+#include "batch-runner.h"
+#include <iostream>
+#include <string>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstdint>
+
+// Reads a non-negative decimal count; false on anything else (sign, junk, overflow)
+static bool parse_count(const char* text, size_t& value) {
+    if (!std::isdigit(static_cast<unsigned char>(text[0]))) return false;
+    char* end = nullptr;
+    errno = 0;
+    unsigned long long parsed = std::strtoull(text, &end, 10);
+    if (errno == ERANGE || *end != '\0' || parsed > static_cast<unsigned long long>(SIZE_MAX)) return false;
+    value = static_cast<size_t>(parsed);
+    return true;
+}
+
+// Usage:
+//   QM_Algorithm_Implementation                                     interactive menu
+//   QM_Algorithm_Implementation <input_file> [output_verilog.v] [--heuristic iterations]
+//                                                                   one file, full report
+//   QM_Algorithm_Implementation --batch <dir|glob|@manifest> [results_file] [-j threads] [--cache file] [--no-np]
+int main(int argc, char* argv[]) {
+    if (argc >= 2 && std::string(argv[1]) == "--batch") {
+        vector<string> positional;
+        size_t threads = 0;
+        std::string cache;
+        bool np_classes = true;
+        bool valid = true;
+        for (int i = 2; i < argc; i++) {
+            std::string arg = argv[i];
+            if ((arg == "-j" || arg == "--threads") && i + 1 < argc) {
+                valid = parse_count(argv[++i], threads) && valid;
+            } else if (arg == "--cache" && i + 1 < argc) {
+                cache = argv[++i];
+            } else if (arg == "--no-np") {
+                np_classes = false;
+            } else {
+                positional.push_back(arg);
+            }
+        }
+        if (!valid || positional.empty() || positional.size() > 2) {
+            std::cerr << "Usage: " << argv[0] << " --batch <dir|glob|@manifest> [results_file] [-j threads] [--cache file] [--no-np]\n";
+            return 1;
+        }
+        vector<string> files;
+        if (!BatchRunner::collect_inputs(positional[0], files)) {
+            return 1;
+        }
+        BatchRunner runner(threads, cache);
+        runner.set_np_classes(np_classes);
+        return runner.run(files, positional.size() == 2 ? positional[1] : "batch_results.txt") ? 0 : 1;
+    }
 
-int main() {
     QuineMcCluskeyDriver driver;
-    driver.run_interactive();
+    if (argc >= 2) {
+        vector<string> positional;
+        bool valid = true;
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            if (arg == "--heuristic" && i + 1 < argc) {
+                size_t iterations = 0;
+                if (parse_count(argv[++i], iterations)) {
+                    driver.set_heuristic_iterations(iterations);
+                } else {
+                    valid = false;
+                }
+            } else {
+                positional.push_back(arg);
+            }
+        }
+        if (!valid || positional.empty() || positional.size() > 2) {
+            std::cerr << "Usage: " << argv[0] << " <input_file> [output_verilog.v] [--heuristic iterations]\n";
+            return 1;
+        }
+        driver.run_batch(positional[0], positional.size() == 2 ? positional[1] : "");
+    } else {
+        driver.run_interactive();
+    }
     return 0;
-}
\ No newline at end of file
+}
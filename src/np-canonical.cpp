@@ -0,0 +1,117 @@
+#include "../include/np-canonical.h"
+#include <utility>
+
+// Truth-table positions whose index has bit i set
+static const uint64_t VARIABLE_MASK[6] = {
+  0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL, 0xF0F0F0F0F0F0F0F0ULL,
+  0xFF00FF00FF00FF00ULL, 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL
+};
+
+// Table of h(y ^ e_i)
+static uint64_t flip_variable(uint64_t table, int i) {
+  int shift = 1 << i;
+  return ((table & VARIABLE_MASK[i]) >> shift) | ((table & ~VARIABLE_MASK[i]) << shift);
+}
+
+// Table of h(y with bits i and j exchanged), i < j
+static uint64_t swap_variables(uint64_t table, int i, int j) {
+  int shift = (1 << j) - (1 << i);
+  uint64_t high = VARIABLE_MASK[j] & ~VARIABLE_MASK[i]; // bit j = 1, bit i = 0
+  uint64_t low = high >> shift; // bit j = 0, bit i = 1
+  return (table & ~(high | low)) | ((table & high) >> shift) | ((table & low) << shift);
+}
+
+Implicant NpTransform::apply(const Implicant &cube) const {
+  Implicant::word value = 0, mask = 0;
+  for(int i = 0; i < variables; i++) {
+    Implicant::word bit = Implicant::word(1) << perm[i];
+    if ((cube.get_mask() >> i) & 1) {
+      mask |= bit;
+    } else if (((cube.get_value() >> i) ^ (neg >> i)) & 1) {
+      value |= bit;
+    }
+  }
+  return Implicant(value, mask, variables);
+}
+
+bool NpTransform::is_identity() const {
+  if (neg != 0) return false;
+  for(int i = 0; i < variables; i++) {
+    if (perm[i] != i) return false;
+  }
+  return true;
+}
+
+bool NpCanonical::canonicalize(const Expression &expression, Expression &representative, NpTransform &transform) {
+  int n = expression.numberOfBits;
+  if (n < 1 || n > MAX_VARIABLES || expression.has_cubes()) return false;
+
+  const int size = 1 << n;
+  uint64_t on = 0, dc = 0;
+  for(Term term : expression.minterms) {
+    if (!expression.in_range(term)) return false;
+    on |= uint64_t(1) << term;
+  }
+  for(Term term : expression.dontcares) {
+    if (!expression.in_range(term)) return false;
+    dc |= uint64_t(1) << term;
+  }
+  dc &= ~on;
+
+  // Current state of the walk and the best one seen
+  NpTransform current;
+  current.variables = n;
+  transform = current;
+  uint64_t best_on = on, best_dc = dc;
+
+  auto visit_negations = [&]() {
+    // Gray code: one variable flip per step visits all 2^n negations
+    for(int k = 0; k < size; k++) {
+      if (k > 0) {
+        int i = __builtin_ctz(k);
+        on = flip_variable(on, i);
+        dc = flip_variable(dc, i);
+        current.neg ^= uint32_t(1) << i;
+      }
+      if (on < best_on || (on == best_on && dc < best_dc)) {
+        best_on = on;
+        best_dc = dc;
+        transform = current;
+      }
+    }
+  };
+
+  auto swap = [&](int i, int j) {
+    if (i == j) return;
+    if (i > j) std::swap(i, j);
+    on = swap_variables(on, i, j);
+    dc = swap_variables(dc, i, j);
+    std::swap(current.perm[i], current.perm[j]);
+    uint32_t bits = ((current.neg >> i) ^ (current.neg >> j)) & 1;
+    current.neg ^= (bits << i) | (bits << j);
+  };
+
+  // Heap's algorithm: one swap per permutation
+  int counter[6] = {0, 0, 0, 0, 0, 0};
+  visit_negations();
+  for(int i = 1; i < n; ) {
+    if (counter[i] < i) {
+      swap((i % 2 == 0) ? 0 : counter[i], i);
+      visit_negations();
+      counter[i]++;
+      i = 1;
+    } else {
+      counter[i] = 0;
+      i++;
+    }
+  }
+
+  representative.numberOfBits = n;
+  representative.minterms.clear();
+  representative.dontcares.clear();
+  for(int term = 0; term < size; term++) {
+    if ((best_on >> term) & 1) representative.minterms.push_back(term);
+    if ((best_dc >> term) & 1) representative.dontcares.push_back(term);
+  }
+  return true;
+}
@@ -0,0 +1,75 @@
+#include "../include/offset-engine.h"
+#include "../include/term-set.h"
+#include <algorithm>
+
+// Constructors
+OffsetEngine::OffsetEngine(int _numberOfBits) : numberOfBits(_numberOfBits) {}
+
+size_t OffsetEngine::off_set_size(int variables, size_t care) {
+  if (variables >= int(sizeof(size_t) * 8)) return SIZE_MAX;
+  size_t points = size_t(1) << variables;
+  return care >= points ? 0 : points - care;
+}
+
+void OffsetEngine::sharp(const vector<Term> &off, vector<Implicant> &primes) const {
+  using word = Implicant::word;
+  const word all = numberOfBits >= 64 ? ~word(0) : (word(1) << numberOfBits) - 1;
+
+  vector<word> values(1, 0), masks(1, all);
+  vector<word> next_values, next_masks;
+  vector<vector<size_t>> near(numberOfBits); // Cubes that miss the point on that bit only
+  vector<size_t> hit; // Cubes that contain the point
+  for(Term point : off) {
+    for(auto &bucket : near) bucket.clear();
+    hit.clear();
+    next_values.clear();
+    next_masks.clear();
+    for(size_t c = 0; c < values.size(); c++) {
+      word apart = (values[c] ^ point) & ~masks[c];
+      if (apart == 0) {
+        hit.push_back(c);
+        continue;
+      }
+      if ((apart & (apart - 1)) == 0) near[__builtin_ctzll(apart)].push_back(next_values.size());
+      next_values.push_back(values[c]);
+      next_masks.push_back(masks[c]);
+    }
+
+    // Each dash of a cube through the point is fixed away from it; the result is maximal unless a
+    // cube that misses the point on that same bit contains it
+    for(size_t c : hit) {
+      for(word rest = masks[c]; rest; rest &= rest - 1) {
+        int i = __builtin_ctzll(rest);
+        word b = word(1) << i;
+        word value = values[c] | (~point & b), mask = masks[c] & ~b;
+        bool covered = false;
+        for(size_t d : near[i]) {
+          if ((mask & ~next_masks[d]) == 0 && ((value ^ next_values[d]) & ~next_masks[d]) == 0) {
+            covered = true;
+            break;
+          }
+        }
+        if (!covered) {
+          next_values.push_back(value);
+          next_masks.push_back(mask);
+        }
+      }
+    }
+    values.swap(next_values);
+    masks.swap(next_masks);
+  }
+
+  primes.clear();
+  primes.reserve(values.size());
+  for(size_t c = 0; c < values.size(); c++) primes.emplace_back(values[c], masks[c], numberOfBits);
+}
+
+void OffsetEngine::generate_primes(const Expression &expression, vector<Implicant> &primes) const {
+  primes.clear();
+  if (expression.minterms.empty() && expression.dontcares.empty() && !expression.has_cubes()) return;
+
+  vector<Term> off;
+  expression.off_set().to_vector(off);
+  sharp(off, primes);
+  std::sort(primes.begin(), primes.end());
+}
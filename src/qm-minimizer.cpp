@@ -1,42 +1,50 @@
 #include "qm-minimizer.h"
+#include "combine-engine.h"
+#include "expansion-engine.h"
+#include "ternary-engine.h"
+#include "unate-engine.h"
+#include "offset-engine.h"
+#include "term-set.h"
+#include "combine-kernels.h"
+#include "cover-solver.h"
+#include "cover-reduction.h"
+#include "cover-table.h"
+#include "truth-table-minimizer.h"
+#include <cmath>
+#include <climits>
+#include <unordered_set>
+#include <stdexcept>
+
+using std::unordered_set;
+
+// Largest Petrick product (log2 of the product of clause sizes) CoverEngine::$auto will expand
+static const double PETRICK_MAX_LOG_PRODUCT = 24.0;
+
+// PrimeEngine::$auto takes the ternary table once at least 1 / TERNARY_MIN_DENSITY of the terms
+// are care points; sparser functions have too few implicants to pay for visiting all 3^n cubes
+static const size_t TERNARY_MIN_DENSITY = 3;
+
+// PrimeEngine::$auto works from the off-set once it is at most 1 / OFFSET_MAX_DENSITY of the space
+static const size_t OFFSET_MAX_DENSITY = 64;
+
+// PrimeEngine::$auto hands don't-care cubes to the unate engine unexpanded once their points
+// outnumber the entries of the description CUBE_MIN_GAIN times
+static const size_t CUBE_MIN_GAIN = 16;
 
 
 // Constructors
 QMMinimizer::QMMinimizer(const Expression &expression) {
 
-  // Set expression
+  // Set expression. Minterm cubes are expanded, their points are the rows of the covering problem;
+  // duplicate terms would become duplicate seeds
+  if (expression.minterm_points() > Expression::MAX_EXPANDED_TERMS)
+    throw std::length_error("Minterms cover more than Expression::MAX_EXPANDED_TERMS points");
   this->expression = expression;
+  this->expression.expand_cubes(false);
+  this->expression.canonicalize();
 
   // Initialize member variables
   numberOfBits = expression.numberOfBits;
-
-  implicant_groups.resize(numberOfBits + 1);
-
-  for(int minterm : expression.minterms) {
-
-    // Get group index based on number of ones in minterm
-    int group_idx = __builtin_popcount(minterm);
-    
-    // Ensure valid group index
-    assert(group_idx >= 0 && group_idx <= numberOfBits);
-
-    // Create implicant and add to group
-    implicant_groups[group_idx].emplace_back(Implicant(minterm, numberOfBits));
-
-  }
-
-  for(int dontcare : expression.dontcares) {
-
-    // Get group index based on number of ones in dontcare
-    int group_idx = __builtin_popcount(dontcare);
-    
-    // Ensure valid group index
-    assert(group_idx >= 0 && group_idx <= numberOfBits);
-
-    // Create implicant and add to group
-    implicant_groups[group_idx].emplace_back(Implicant(dontcare, numberOfBits));
-  }
-
 }
 
 // Helper function to combine two adjacent groups
@@ -103,56 +111,102 @@ bool QMMinimizer::combine(vector<vector<Implicant>> &current_groups,
   return any_combined;
 }
 
-void QMMinimizer::minimize(vector<Implicant> &pe, vector<bool> &epi, 
-                          vector<int> &epi_coverage, 
-                          vector<vector<Implicant>> &minimized_expressions,
-                          vector<vector<int>> &solutions_indices) {
-  // Step 1: Generate all prime implicants through iterative combination
+// Seed groups of the combining generators, built on first use so the other engines never pay for
+// one implicant per care term
+void QMMinimizer::build_implicant_groups() {
+  if (!implicant_groups.empty()) return;
+  implicant_groups.resize(numberOfBits + 1);
+
+  for(Term minterm : expression.minterms) {
+
+    // Get group index based on number of ones in minterm
+    int group_idx = __builtin_popcountll(minterm);
+    
+    // Ensure valid group index
+    assert(group_idx >= 0 && group_idx <= numberOfBits);
+
+    // Create implicant and add to group
+    implicant_groups[group_idx].emplace_back(Implicant(minterm, numberOfBits));
+
+  }
+
+  for(Term dontcare : expression.dontcares) {
+
+    // Get group index based on number of ones in dontcare
+    int group_idx = __builtin_popcountll(dontcare);
+    
+    // Ensure valid group index
+    assert(group_idx >= 0 && group_idx <= numberOfBits);
+
+    // Create implicant and add to group
+    implicant_groups[group_idx].emplace_back(Implicant(dontcare, numberOfBits));
+  }
+}
+
+// Classic generator: iterative pairwise combination of adjacent groups
+void QMMinimizer::generate_primes_classic(vector<Implicant> &pe) {
+  using word = Implicant::word;
+
+  build_implicant_groups();
   vector<vector<Implicant>> current_groups = implicant_groups;
   vector<vector<Implicant>> next_groups;
   
   // Track which implicants at each level were successfully combined
   set<Implicant> all_primes;
+
+  // Inner comparison kernel (SIMD when the CPU supports it)
+  combine_kernels::KernelFn find_neighbors = combine_kernels::select(combine_kernel);
+  vector<word> candidate_values, candidate_masks;
+  vector<uint32_t> hits;
   
   while(true) {
     next_groups.clear();
     next_groups.resize(current_groups.size() > 0 ? current_groups.size() - 1 : 0);
     
     // Track which implicants were combined in this iteration
-    vector<set<int>> used_in_groups(current_groups.size());
+    vector<vector<bool>> used_in_groups(current_groups.size());
+    for(size_t i = 0; i < current_groups.size(); i++) {
+      used_in_groups[i].assign(current_groups[i].size(), false);
+    }
     
     bool any_combined = false;
     
     // Try to combine adjacent groups
-    for(size_t i = 0; i < current_groups.size() - 1; i++) {
+    for(size_t i = 0; i + 1 < current_groups.size(); i++) {
       const auto &group1 = current_groups[i];
       const auto &group2 = current_groups[i + 1];
+
+      // Lay group2 out as separate value and mask arrays for the kernel
+      candidate_values.resize(group2.size());
+      candidate_masks.resize(group2.size());
+      for(size_t k = 0; k < group2.size(); k++) {
+        candidate_values[k] = group2[k].get_value();
+        candidate_masks[k] = group2[k].get_mask();
+      }
+      hits.resize(group2.size());
+
+      // Implicants already added to next_groups[i]
+      unordered_set<Implicant, ImplicantHash> existing;
       
       for(size_t j = 0; j < group1.size(); j++) {
-        for(size_t k = 0; k < group2.size(); k++) {
-          // Check if they differ by exactly one bit
-          if (group1[j] - group2[k] == 1) {
-            // Combine them
-            Implicant new_implicant = group1[j] + group2[k];
-            
-            // Check if this implicant already exists in next_groups[i]
-            bool exists = false;
-            for(const auto &existing : next_groups[i]) {
-              if (existing == new_implicant) {
-                exists = true;
-                break;
-              }
-            }
-            
-            if (!exists) {
-              next_groups[i].push_back(new_implicant);
-            }
-            
-            // Mark these implicants as used
-            used_in_groups[i].insert(j);
-            used_in_groups[i + 1].insert(k);
-            any_combined = true;
+        // Find every candidate that differs by exactly one bit
+        size_t found = find_neighbors(group1[j].get_value(), group1[j].get_mask(),
+                                      candidate_values.data(), candidate_masks.data(),
+                                      group2.size(), hits.data());
+
+        for(size_t h = 0; h < found; h++) {
+          size_t k = hits[h];
+
+          // Combine them
+          Implicant new_implicant = group1[j] + group2[k];
+          if (existing.insert(new_implicant).second) {
+            next_groups[i].push_back(new_implicant);
           }
+          
+          // Mark these implicants as used
+          used_in_groups[i][j] = true;
+          used_in_groups[i + 1][k] = true;
+          any_combined = true;
         }
       }
     }
@@ -161,7 +215,7 @@ void QMMinimizer::minimize(vector<Implicant> &pe, vector<bool> &epi,
     for(size_t i = 0; i < current_groups.size(); i++) {
       for(size_t j = 0; j < current_groups[i].size(); j++) {
         // If this implicant was NOT used in combination, it's a prime
-        if (used_in_groups[i].find(j) == used_in_groups[i].end()) {
+        if (!used_in_groups[i][j]) {
           all_primes.insert(current_groups[i][j]);
         }
       }
@@ -179,110 +233,327 @@ void QMMinimizer::minimize(vector<Implicant> &pe, vector<bool> &epi,
   for(const auto &impl : all_primes) {
     pe.push_back(impl);
   }
+}
+
+// Hash-join generator: see CombineEngine
+void QMMinimizer::generate_primes_hash_join(vector<Implicant> &pe) {
+  build_implicant_groups();
+  vector<Implicant> seeds;
+  for(const auto &group : implicant_groups) {
+    seeds.insert(seeds.end(), group.begin(), group.end());
+  }
+
+  CombineEngine engine(numberOfBits, thread_count);
+  engine.generate_primes(seeds, pe);
+}
+
+PrimeEngine QMMinimizer::get_prime_engine() const {
+  // Don't-care cubes too large to expand can only be taken as cubes
+  if (expression.dontcare_points() > Expression::MAX_EXPANDED_TERMS) return PrimeEngine::$unate;
+  size_t cells = TernaryEngine::table_size(numberOfBits);
+  bool ternary_fits = cells != SIZE_MAX && cells <= table_budget;
+  // A forced ternary table over the budget falls back to expansion, like $auto would
+  if (prime_engine == PrimeEngine::$ternary && !ternary_fits) return PrimeEngine::$expansion;
+  if (prime_engine != PrimeEngine::$auto) return prime_engine;
+
+  size_t care = expression.care_count();
+  size_t entries = expression.minterms.size() + expression.dontcares.size() + expression.dontcare_cubes.size();
+  if (!expression.dontcare_cubes.empty() && care / CUBE_MIN_GAIN >= entries) {
+    return PrimeEngine::$unate;
+  }
+  size_t off = OffsetEngine::off_set_size(numberOfBits, care);
+  if (numberOfBits <= TermSet::MAX_DENSE_BITS && off <= (size_t(1) << numberOfBits) / OFFSET_MAX_DENSITY) {
+    return PrimeEngine::$offset;
+  }
+  if (ternary_fits && care * TERNARY_MIN_DENSITY >= (size_t(1) << numberOfBits)) {
+    return PrimeEngine::$ternary;
+  }
+  return PrimeEngine::$expansion;
+}
+
+// Ternary generator: see TernaryEngine
+void QMMinimizer::generate_primes_ternary(vector<Implicant> &pe) {
+  TernaryEngine engine(numberOfBits);
+  engine.generate_primes(expression.minterms, expression.dontcares, pe);
+}
+
+// Unate recursive generator: see UnateEngine
+void QMMinimizer::generate_primes_unate(vector<Implicant> &pe) {
+  UnateEngine engine(numberOfBits);
+  engine.generate_primes(expression.minterms, expression.dontcares, expression.dontcare_cubes, pe);
+}
+
+// Off-set generator: see OffsetEngine
+void QMMinimizer::generate_primes_offset(vector<Implicant> &pe) {
+  OffsetEngine engine(numberOfBits);
+  engine.generate_primes(expression, pe);
+}
+
+// Cube-expansion generator: see ExpansionEngine
+void QMMinimizer::generate_primes_expansion(vector<Implicant> &pe) {
+  ExpansionEngine engine(numberOfBits, thread_count, combine_kernel);
+  engine.generate_primes(expression.minterms, expression.dontcares, pe);
+}
+
+void QMMinimizer::minimize(vector<Implicant> &pe, vector<bool> &epi, 
+                          vector<int> &epi_coverage, 
+                          vector<vector<Implicant>> &minimized_expressions,
+                          vector<vector<int>> &solutions_indices) {
+  // Heuristic mode skips the exact paths. Otherwise functions of up to 4 variables without don't
+  // cares come straight from the precomputed table, other functions of up to 6 variables go to the
+  // truth-table engine
+  path = MinimizePath::$general;
+
+  // Don't-care cubes stay cubes only for the unate engine, which works on a cover; every other
+  // path takes points. Cubes too large to expand stay cubes whatever the settings
+  if (!expression.dontcare_cubes.empty() && expression.dontcare_points() <= Expression::MAX_EXPANDED_TERMS &&
+      (heuristic_iterations > 0 || numberOfBits <= 6 || get_prime_engine() != PrimeEngine::$unate)) {
+    expression.expand_cubes();
+    expression.canonicalize();
+  }
+
+  if (minimize_heuristic(pe, epi, solutions_indices) || lookup_cover_table(pe, epi, solutions_indices) ||
+      minimize_truth_table(pe, epi, solutions_indices)) {
+    coverage = CoverageTable(pe, expression.minterms);
+    reduction_stats = CoverReductionStats();
+    epi_coverage.clear();
+    build_expressions(pe, solutions_indices, minimized_expressions);
+    return;
+  }
+
+  // Step 1: Generate all prime implicants
+  switch(get_prime_engine()) {
+    case PrimeEngine::$classic: generate_primes_classic(pe); break;
+    case PrimeEngine::$expansion: generate_primes_expansion(pe); break;
+    case PrimeEngine::$ternary: generate_primes_ternary(pe); break;
+    case PrimeEngine::$unate: generate_primes_unate(pe); break;
+    case PrimeEngine::$offset: generate_primes_offset(pe); break;
+    default: generate_primes_hash_join(pe); break;
+  }
   
-  // Step 2: Identify essential prime implicants
-  epi.resize(pe.size(), false);
+  // Step 2: Build the coverage table once; a minterm covered by a single PI makes that PI essential
+  coverage = CoverageTable(pe, expression.minterms);
+  epi = coverage.essential_pis();
   epi_coverage.clear();
-  
-  // Build coverage table - for each minterm, find which PIs cover it
-  for(int minterm : expression.minterms) {
-    vector<int> covering_pis;
-    
+
+  // Step 3: Reduce what the EPIs leave to its cyclic core, then cover the core
+  solutions_indices.clear();
+  CoverEngine engine = cover_engine;
+
+  // Every minimum solution is wanted only from the unbounded Petrick expansion
+  bool keep_all = (engine != CoverEngine::$branch_and_bound) && solution_limit == 0;
+  vector<vector<int>> core;
+  vector<int> fixed;
+  prepare_core(pe, epi, !keep_all, core, fixed);
+
+  if (engine == CoverEngine::$auto) {
+    engine = petrick_fits(core) ? CoverEngine::$petrick : CoverEngine::$branch_and_bound;
+  }
+
+  if (engine == CoverEngine::$branch_and_bound) {
+    solve_branch_and_bound(pe, epi, core, fixed, solutions_indices);
+  } else if (solution_limit > 0) {
+    solve_streaming(pe, epi, core, fixed, [&](const vector<int> &solution) {
+      solutions_indices.push_back(solution);
+      return solutions_indices.size() < solution_limit;
+    });
+  } else {
+    solve_petrick(pe, epi, core, fixed, solutions_indices);
+  }
+
+  build_expressions(pe, solutions_indices, minimized_expressions);
+}
+
+bool QMMinimizer::lookup_cover_table(vector<Implicant> &pe, vector<bool> &epi, vector<vector<int>> &solutions_indices) {
+  if (!use_cover_table || numberOfBits > cover_table::MAX_VARIABLES || !expression.dontcares.empty()) return false;
+  // Bounded or branch-and-bound runs expect their own solution sets
+  if (solution_limit > 0 || cover_engine == CoverEngine::$branch_and_bound) return false;
+
+  uint32_t truth_table = 0;
+  for(Term term : expression.minterms) {
+    if (!expression.in_range(term)) return false;
+    truth_table |= uint32_t(1) << term;
+  }
+  if (!cover_table::lookup(numberOfBits, truth_table, pe, epi, solutions_indices)) return false;
+
+  path = MinimizePath::$cover_table;
+  return true;
+}
+
+bool QMMinimizer::petrick_fits(const vector<vector<int>> &core) {
+  // Petrick's expansion can grow to the product of the clause sizes
+  double log_product = 0;
+  for(const auto &row : core) log_product += std::log2(double(row.size()));
+  return log_product <= PETRICK_MAX_LOG_PRODUCT;
+}
+
+bool QMMinimizer::minimize_truth_table(vector<Implicant> &pe, vector<bool> &epi, vector<vector<int>> &solutions_indices) {
+  if (!use_truth_table || numberOfBits > 6) return false;
+
+  // Branch and bound is asked for one minimum solution. CoverEngine::$auto settles for one as well
+  // when the general path would: the first cover comes with the PIs, and the rest are enumerated
+  // only if Petrick's product over the cyclic core stays under the same cutoff
+  size_t limit = (cover_engine == CoverEngine::$branch_and_bound) ? 1 : solution_limit;
+  bool decide = (cover_engine == CoverEngine::$auto && limit == 0);
+  if (!truth_table_minimize(expression, decide ? 1 : limit, pe, epi, solutions_indices)) return false;
+  if (decide) {
+    vector<vector<int>> core;
+    vector<int> fixed;
+    coverage = CoverageTable(pe, expression.minterms);
+    prepare_core(pe, epi, false, core, fixed);
+    if (petrick_fits(core)) truth_table_minimize(expression, 0, pe, epi, solutions_indices);
+  }
+
+  path = MinimizePath::$truth_table;
+  return true;
+}
+
+bool QMMinimizer::minimize_heuristic(vector<Implicant> &pe, vector<bool> &epi, vector<vector<int>> &solutions_indices) {
+  // The care set of EspressoMinimizer is a set of points, so unexpanded don't-care cubes take the
+  // exact unate path
+  if (heuristic_iterations == 0 || !expression.dontcare_cubes.empty()) return false;
+
+  EspressoMinimizer espresso(expression, heuristic_iterations);
+  espresso.minimize(pe, epi);
+  heuristic_stats = espresso.get_stats();
+
+  // The cover is the only solution: other PIs ascending, then the EPIs
+  vector<int> solution;
+  for(int essential = 0; essential < 2; essential++) {
     for(size_t i = 0; i < pe.size(); i++) {
-      auto covered = pe[i].get_covered_terms();
-      if (std::find(covered.begin(), covered.end(), minterm) != covered.end()) {
-        covering_pis.push_back(i);
-      }
-    }
-    
-    // If only one PI covers this minterm, it's essential
-    if (covering_pis.size() == 1) {
-      epi[covering_pis[0]] = true;
+      if (epi[i] == (essential == 1)) solution.push_back(static_cast<int>(i));
     }
   }
-  
-  // Step 3: Use Petrick's method to find minimal covering
-  vector<vector<int>> solutions;
-  petrick(pe, epi, solutions);
+  solutions_indices.assign(1, solution);
 
-  // Return raw solution indices to caller
-  solutions_indices = solutions;
+  path = MinimizePath::$heuristic;
+  return true;
+}
 
-  // Convert solutions to implicant lists
+void QMMinimizer::build_expressions(const vector<Implicant> &pe, const vector<vector<int>> &solutions_indices,
+                                    vector<vector<Implicant>> &minimized_expressions) const {
   minimized_expressions.clear();
-  for(const auto &sol : solutions) {
+  minimized_expressions.reserve(solutions_indices.size());
+  for(const auto &sol : solutions_indices) {
     vector<Implicant> expr;
+    expr.reserve(sol.size());
     for(int idx : sol) {
       if (idx >= 0 && idx < static_cast<int>(pe.size())) {
         expr.push_back(pe[idx]);
       }
     }
-    minimized_expressions.push_back(expr);
+    minimized_expressions.push_back(std::move(expr));
   }
 }
 
 // Petrick's method to find minimal covering of remaining minterms
 void QMMinimizer::petrick(const vector<Implicant> &pe, vector<bool>& epi, vector<vector<int>>& solutions) {
 
-  // Identify minterms that still need to be covered
-  set<int> to_be_covered(expression.minterms.begin(), expression.minterms.end());
-  for(int i = 0; i < int(pe.size()); i++) {
-    if (epi[i]) {
-      const auto& covered_terms = pe[i].get_covered_terms();
-      for(int term : covered_terms) {
-        if (to_be_covered.find(term) != to_be_covered.end()) {
-          to_be_covered.erase(term);
-        }
-      }
-    }
+  // Bounded mode: stream and stop after the first solution_limit solutions
+  if (solution_limit > 0) {
+    petrick(pe, epi, [&](const vector<int> &solution) {
+      solutions.push_back(solution);
+      return solutions.size() < solution_limit;
+    });
+    return;
   }
 
-  if (to_be_covered.empty()) {
-    solutions.emplace_back();
-    for (int i = 0; i < int(pe.size()); i++) {
-      if (epi[i]) {
-        solutions[0].push_back(i);
-      }
-    }
+  coverage = CoverageTable(pe, expression.minterms);
+  vector<vector<int>> core;
+  vector<int> fixed;
+  prepare_core(pe, epi, false, core, fixed);
+  solve_petrick(pe, epi, core, fixed, solutions);
+}
+
+void QMMinimizer::petrick(const vector<Implicant> &pe, vector<bool> &epi, const SolutionCallback &on_solution) {
+  coverage = CoverageTable(pe, expression.minterms);
+  vector<vector<int>> core;
+  vector<int> fixed;
+  prepare_core(pe, epi, true, core, fixed);
+  solve_streaming(pe, epi, core, fixed, on_solution);
+}
+
+void QMMinimizer::branch_and_bound(const vector<Implicant> &pe, vector<bool> &epi, vector<vector<int>> &solutions) {
+  coverage = CoverageTable(pe, expression.minterms);
+  vector<vector<int>> core;
+  vector<int> fixed;
+  prepare_core(pe, epi, true, core, fixed);
+  solve_branch_and_bound(pe, epi, core, fixed, solutions);
+}
+
+void QMMinimizer::build_cover_rows(const vector<Implicant> &pe, const vector<bool> &epi, vector<vector<int>> &clauses) {
+  if (coverage.pi_count() != pe.size()) coverage = CoverageTable(pe, expression.minterms);
+
+  // One clause per minterm not covered by an EPI, listing the PIs that cover it
+  clauses = coverage.pis_covering(coverage.uncovered_rows(epi));
+}
+
+void QMMinimizer::prepare_core(const vector<Implicant> &pe, const vector<bool> &epi, bool pi_dominance,
+                               vector<vector<int>> &core, vector<int> &fixed) {
+  build_cover_rows(pe, epi, core);
+
+  // A PI costs its literal count, so dominance never trades a PI for a wider one
+  vector<long long> costs(pe.size());
+  for(size_t i = 0; i < pe.size(); i++) {
+    costs[i] = numberOfBits - pe[i].get_dash_count();
+  }
+
+  fixed.clear();
+  long long fixed_cost = 0;
+  reduction_stats = CoverReductionStats();
+  CoverReduction::reduce(core, costs, fixed, fixed_cost, &reduction_stats, pi_dominance);
+}
+
+vector<int> QMMinimizer::assemble_solution(const vector<int> &core_solution, const vector<int> &fixed, const vector<bool> &epi) const {
+  vector<int> solution(core_solution);
+  solution.insert(solution.end(), fixed.begin(), fixed.end());
+  std::sort(solution.begin(), solution.end());
+  for(int i = 0; i < int(epi.size()); i++) {
+    if (epi[i]) solution.push_back(i);
+  }
+  return solution;
+}
+
+void QMMinimizer::solve_petrick(const vector<Implicant> &pe, const vector<bool> &epi, const vector<vector<int>> &core,
+                                const vector<int> &fixed, vector<vector<int>> &solutions) {
+  if (core.empty()) {
+    solutions.push_back(assemble_solution({}, fixed, epi));
     return;
   }
 
-  // Build the Petrick's method table
-  int remaining = int(to_be_covered.size());
-  vector<vector<set<int>>> P(remaining);
-  for(int i = 0; i < int(pe.size()); i++) {
-    if (epi[i]) continue;
-    const auto& covered_terms = pe[i].get_covered_terms();
-    for(int term : covered_terms) {
-      auto it = to_be_covered.find(term);
-      if (it != to_be_covered.end()) {
-        P[distance(to_be_covered.begin(), it)].push_back({i});
-      }
+  // Build the Petrick's method table; every product term is a bitset over PI indices
+  vector<vector<PiSet>> P(core.size());
+  for(size_t pos = 0; pos < core.size(); pos++) {
+    for(int i : core[pos]) {
+      PiSet single(pe.size());
+      single.insert(i);
+      P[pos].push_back(single);
     }
   }
 
   // Minimize product of sums
   while(int(P.size()) > 1) {
-    vector<vector<set<int>>> new_P;
+    vector<vector<PiSet>> new_P;
     for(int i = 0; i < int(P.size()); i += 2) {
       assert(!P[i].empty());
       if (i + 1 < int(P.size())) {
         assert(!P[i + 1].empty());
         // Get the common set of implicants between P[i] and P[i + 1]
         // (X + Y)(X + Z) = X + YZ
-        vector<set<int>> common;
+        vector<PiSet> common;
         for(const auto &a : P[i]) {
           for(const auto &b : P[i + 1]) {
             if (a == b) common.push_back(a);
           }
         }
+        unordered_set<PiSet, PiSetHash> common_lookup(common.begin(), common.end());
 
-        auto remove_common = [&](vector<set<int>> &from) {
+        auto remove_common = [&](vector<PiSet> &from) {
           from.erase(
             remove_if(
               from.begin(), from.end(),
-              [&](const set<int> &s) {
-                return find(common.begin(), common.end(), s) != common.end();
+              [&](const PiSet &s) {
+                return common_lookup.count(s) > 0;
               }
             ), from.end()
           );
@@ -299,7 +570,7 @@ void QMMinimizer::petrick(const vector<Implicant> &pe, vector<bool>& epi, vector
 
         // Remove duplicates
         sort(common.begin(), common.end(),
-          [](const set<int> &s1, const set<int> &s2) {
+          [](const PiSet &s1, const PiSet &s2) {
             return s1.size() < s2.size();
           });
 
@@ -317,14 +588,6 @@ void QMMinimizer::petrick(const vector<Implicant> &pe, vector<bool>& epi, vector
     P = new_P;
   }
 
-  // Conver into sum of products
-  while(int(P.size()) > 1) {
-    auto multiplied = multiply(P[int(P.size()) - 2], P[int(P.size()) - 1]);
-    P.pop_back();
-    P.pop_back();
-    P.push_back(multiplied);
-  }
-
   // Find the term with the least number of implicants
   int min_size = INT_MAX;
   for(const auto &s : P[0]) {
@@ -335,47 +598,128 @@ void QMMinimizer::petrick(const vector<Implicant> &pe, vector<bool>& epi, vector
 
   for(const auto &s : P[0]) {
     if (int(s.size()) == min_size) {
-      vector<int> solution(s.begin(), s.end());
-      for(int i = 0; i < int(pe.size()); i++) {
-        if (epi[i]) {
-          solution.push_back(i);
-        }
-      }
-      solutions.push_back(solution);
+      solutions.push_back(assemble_solution(s.to_vector(), fixed, epi));
     }
   }
 }
 
+// Depth-first enumeration of the covers of a product of sums with exactly max_size PIs.
+// When branching on a clause, PIs tried in earlier sibling branches are forbidden below,
+// so every cover is produced exactly once.
+namespace {
+  struct CoverEnumerator {
+    const vector<vector<int>> &clauses;  // PIs that can cover each remaining minterm
+    const vector<vector<int>> &pi_clauses; // clauses each PI appears in
+    const QMMinimizer::SolutionCallback &on_solution; // receives the chosen PIs, sorted
+    size_t max_size;
+    vector<int> satisfied; // number of chosen PIs in each clause
+    vector<bool> forbidden;
+    vector<int> chosen;
+    bool found = false;
+
+    // Returns false once the callback asked to stop
+    bool search() {
+      size_t open = 0;
+      while(open < clauses.size() && satisfied[open] > 0) open++;
+
+      if (open == clauses.size()) {
+        vector<int> solution(chosen);
+        std::sort(solution.begin(), solution.end());
+        found = true;
+        return on_solution(solution);
+      }
+      if (chosen.size() == max_size) return true;
+
+      bool keep_going = true;
+      vector<int> tried;
+      for(int pi : clauses[open]) {
+        if (forbidden[pi]) continue;
+
+        chosen.push_back(pi);
+        for(int c : pi_clauses[pi]) satisfied[c]++;
+        keep_going = search();
+        for(int c : pi_clauses[pi]) satisfied[c]--;
+        chosen.pop_back();
+
+        forbidden[pi] = true;
+        tried.push_back(pi);
+        if (!keep_going) break;
+      }
+      for(int pi : tried) forbidden[pi] = false;
 
+      return keep_going;
+    }
+  };
+}
 
-vector<set<int>> QMMinimizer::multiply(const vector<set<int>> &a, const vector<set<int>> &b) {
-  vector<set<int>> product;
+void QMMinimizer::solve_streaming(const vector<Implicant> &pe, const vector<bool> &epi, const vector<vector<int>> &core,
+                                  const vector<int> &fixed, const SolutionCallback &on_solution) {
+  if (core.empty()) {
+    on_solution(assemble_solution({}, fixed, epi));
+    return;
+  }
+
+  vector<vector<int>> pi_clauses(pe.size());
+  for(int c = 0; c < int(core.size()); c++) {
+    for(int pi : core[c]) pi_clauses[pi].push_back(c);
+  }
+
+  SolutionCallback emit = [&](const vector<int> &core_solution) {
+    return on_solution(assemble_solution(core_solution, fixed, epi));
+  };
+
+  // Increase the cover size until the smallest covers are found
+  for(size_t size = 1; size <= core.size(); size++) {
+    CoverEnumerator enumerator{core, pi_clauses, emit, size,
+                               vector<int>(core.size(), 0), vector<bool>(pe.size(), false), {}};
+    bool keep_going = enumerator.search();
+    if (enumerator.found || !keep_going) return;
+  }
+}
+
+void QMMinimizer::solve_branch_and_bound(const vector<Implicant> &pe, const vector<bool> &epi, const vector<vector<int>> &core,
+                                         const vector<int> &fixed, vector<vector<int>> &solutions) {
+  vector<int> core_solution;
+  if (!core.empty()) {
+    CoverSolver solver(core, int(pe.size()));
+    core_solution = solver.solve();
+  }
+  solutions.push_back(assemble_solution(core_solution, fixed, epi));
+}
+
+vector<PiSet> QMMinimizer::multiply(const vector<PiSet> &a, const vector<PiSet> &b) {
+  vector<PiSet> product;
+  product.reserve(a.size() * b.size());
 
   for(const auto &set_a : a) {
     for(const auto &set_b : b) {
-      set<int> combined = set_a;
-      combined.insert(set_b.begin(), set_b.end());
-      product.push_back(combined);
+      product.push_back(set_a | set_b);
     }
   }
 
   sort(product.begin(), product.end(),
-    [](const set<int> &s1, const set<int> &s2) {
+    [](const PiSet &s1, const PiSet &s2) {
       return s1.size() < s2.size();
     });
 
-  // Remove supersets
-  vector<set<int>> minimized;
+  // Remove supersets; kept terms are bucketed by size so each term is only checked
+  // against terms that are no larger than itself
+  vector<PiSet> minimized;
+  vector<vector<size_t>> kept_by_size;
   for(const auto &s : product) {
     bool is_superset = false;
-    for(const auto &m : minimized) {
-      if (includes(s.begin(), s.end(), m.begin(), m.end())) {
-        is_superset = true;
-        break;
+    for(size_t size = 0; size < kept_by_size.size() && size <= s.size() && !is_superset; size++) {
+      for(size_t idx : kept_by_size[size]) {
+        if (minimized[idx].is_subset_of(s)) {
+          is_superset = true;
+          break;
+        }
       }
     }
 
     if (!is_superset) {
+      if (kept_by_size.size() <= s.size()) kept_by_size.resize(s.size() + 1);
+      kept_by_size[s.size()].push_back(minimized.size());
       minimized.push_back(s);
     }
   }
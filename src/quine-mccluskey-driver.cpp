@@ -10,6 +10,31 @@
 
 using namespace std;
 
+// Most points listed for one prime implicant; larger cubes are cut short with their point count
+static const size_t MAX_LISTED_TERMS = 4096;
+
+// Binary form of a cube, most significant variable first ('-' for a dash)
+static string cube_string(const Implicant& cube) {
+    string binary;
+    for(int j = 0; j < cube.get_number_of_bits(); j++) {
+        ImplicantBit bit = cube.get_bit(j);
+        if (bit == ImplicantBit::$zero) binary += "0";
+        else if (bit == ImplicantBit::$one) binary += "1";
+        else binary += "-";
+    }
+    return binary;
+}
+
+// Prints a labeled list of cubes if there are any
+static void print_cubes(const char* label, const vector<Implicant>& cubes) {
+    if (cubes.empty()) return;
+    cout << "\n  " << label << ": ";
+    for(size_t i = 0; i < cubes.size(); i++) {
+        cout << cube_string(cubes[i]);
+        if (i < cubes.size() - 1) cout << ", ";
+    }
+}
+
 QuineMcCluskeyDriver::QuineMcCluskeyDriver() 
     : expression_loaded(false), minimization_done(false) {}
 
@@ -39,6 +64,8 @@ bool QuineMcCluskeyDriver::load_from_file(const string& filename) {
             if (i < expression.dontcares.size() - 1) cout << ", ";
         }
     }
+    print_cubes("Minterm cubes", expression.minterm_cubes);
+    print_cubes("Don't-care cubes", expression.dontcare_cubes);
     cout << "\n";
     
     return true;
@@ -59,6 +86,7 @@ void QuineMcCluskeyDriver::run_minimization() {
     cout << "\n--- Running Quine-McCluskey Minimization ---\n";
     
     QMMinimizer qm(expression);
+    qm.set_heuristic_iterations(heuristic_iterations);
     
     prime_implicants.clear();
     essential_pis.clear();
@@ -68,6 +96,9 @@ void QuineMcCluskeyDriver::run_minimization() {
     
     // Get minimized expressions and raw solution indices (from Petrick)
     qm.minimize(prime_implicants, essential_pis, epi_coverage, minimized_expressions, solution_indices);
+    reduction_stats = qm.get_reduction_stats();
+    minimize_path = qm.get_minimize_path();
+    heuristic_stats = qm.get_heuristic_stats();
 
     // Also compute minimal-cost solutions (based on literal count)
     minimal_cost_solution_indices.clear();
@@ -85,30 +116,14 @@ void QuineMcCluskeyDriver::run_minimization() {
         minimal_cost_expressions.push_back(expr);
     }
     
-    calculate_uncovered_minterms();
+    calculate_uncovered_minterms(qm.get_coverage());
     
     minimization_done = true;
     cout << "Minimization completed!\n";
 }
 
-void QuineMcCluskeyDriver::calculate_uncovered_minterms() {
-    uncovered_minterms.clear();
-    set<int> covered;
-    
-    for(size_t i = 0; i < prime_implicants.size(); i++) {
-        if (essential_pis[i]) {
-            auto terms = prime_implicants[i].get_covered_terms();
-            for(int t : terms) {
-                covered.insert(t);
-            }
-        }
-    }
-    
-    for(int m : expression.minterms) {
-        if (covered.find(m) == covered.end()) {
-            uncovered_minterms.push_back(m);
-        }
-    }
+void QuineMcCluskeyDriver::calculate_uncovered_minterms(const CoverageTable& coverage) {
+    uncovered_minterms = coverage.uncovered_minterms(essential_pis);
 }
 
 // Requirement 2: Generate and print all prime implicants
@@ -126,19 +141,15 @@ void QuineMcCluskeyDriver::display_prime_implicants() const {
          << setw(20) << "Algebraic"
          << "Covers Minterms\n";
     cout << string(70, '-') << "\n";
+    if (minimize_path == MinimizePath::$heuristic) {
+        cout << "(heuristic mode: only the primes of the cover are listed)\n";
+    }
     
     for(size_t i = 0; i < prime_implicants.size(); i++) {
         cout << setw(5) << i;
         
         // Binary representation
-        string binary;
-        for(int j = 0; j < prime_implicants[i].get_number_of_bits(); j++) {
-            ImplicantBit bit = prime_implicants[i].get_bit(j);
-            if (bit == ImplicantBit::$zero) binary += "0";
-            else if (bit == ImplicantBit::$one) binary += "1";
-            else binary += "-";
-        }
-        cout << setw(15) << binary;
+        cout << setw(15) << cube_string(prime_implicants[i]);
         
         // Algebraic form
         auto product = prime_implicants[i].generate_product();
@@ -147,19 +158,23 @@ void QuineMcCluskeyDriver::display_prime_implicants() const {
             algebra = "1";
         } else {
             for(size_t j = 0; j < product.size(); j++) {
-                char var = 'A' + product[j].first;
-                algebra += var;
+                algebra += Implicant::variable_name(product[j].first);
                 if (product[j].second) algebra += "'";
             }
         }
         cout << setw(20) << algebra;
         
         // Covered terms
-        vector<int> terms = prime_implicants[i].get_covered_terms();
         cout << "{";
-        for(size_t j = 0; j < terms.size(); j++) {
-            cout << terms[j];
-            if (j < terms.size() - 1) cout << ", ";
+        size_t listed = 0;
+        for(Term term : prime_implicants[i].get_covered_terms()) {
+            if (listed == MAX_LISTED_TERMS) {
+                cout << ", ... (2^" << prime_implicants[i].get_dash_count() << " points)";
+                break;
+            }
+            if (listed > 0) cout << ", ";
+            cout << term;
+            listed++;
         }
         cout << "}";
         
@@ -190,8 +205,7 @@ void QuineMcCluskeyDriver::display_essential_pis() const {
             } else {
                 cout << "   ";
                 for(size_t j = 0; j < product.size(); j++) {
-                    char var = 'A' + product[j].first;
-                    cout << var;
+                    cout << Implicant::variable_name(product[j].first);
                     if (product[j].second) cout << "'";
                 }
             }
@@ -213,6 +227,21 @@ void QuineMcCluskeyDriver::display_essential_pis() const {
             if (i < uncovered_minterms.size() - 1) cout << ", ";
         }
         cout << "}\n";
+        if (minimize_path == MinimizePath::$cover_table) {
+            cout << "Cover: read from the precomputed " << expression.numberOfBits << "-variable table\n";
+        } else if (minimize_path == MinimizePath::$truth_table) {
+            cout << "Cover: exact truth-table search (" << expression.numberOfBits << " variables)\n";
+        } else if (minimize_path == MinimizePath::$heuristic) {
+            cout << "Cover: heuristic EXPAND/IRREDUNDANT/REDUCE (" << heuristic_stats.iterations << " iterations), "
+                 << heuristic_stats.literals << " literals, lower bound " << heuristic_stats.lower_bound
+                 << " (gap " << heuristic_stats.literals - heuristic_stats.lower_bound << ")\n";
+        } else {
+            cout << "Cyclic core: " << reduction_stats.core_minterms << " minterms, "
+                 << reduction_stats.core_pis << " PIs (" << reduction_stats.passes << " passes; dropped "
+                 << reduction_stats.dominated_minterms << " dominated minterms, "
+                 << reduction_stats.dominated_pis << " dominated PIs; "
+                 << reduction_stats.secondary_essentials << " secondary essentials)\n";
+        }
     }
     cout << string(70, '=') << "\n";
 }
@@ -243,8 +272,7 @@ void QuineMcCluskeyDriver::display_minimized_expressions() const {
                         cout << "1";
                     } else {
                         for(size_t j = 0; j < product.size(); j++) {
-                            char var = 'A' + product[j].first;
-                            cout << var;
+                            cout << Implicant::variable_name(product[j].first);
                             if (product[j].second) cout << "'";
                         }
                     }
@@ -282,8 +310,7 @@ void QuineMcCluskeyDriver::display_min_cost_expressions() const {
                         cout << "1";
                     } else {
                         for(size_t j = 0; j < product.size(); j++) {
-                            char var = 'A' + product[j].first;
-                            cout << var;
+                            cout << Implicant::variable_name(product[j].first);
                             if (product[j].second) cout << "'";
                         }
                     }
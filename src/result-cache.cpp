@@ -0,0 +1,191 @@
+#include "../include/result-cache.h"
+#include <algorithm>
+#include <cstring>
+
+static const uint32_t RECORD_MAGIC = 0x31524D51; // "QMR1"
+static const size_t RECORD_HEADER = 16; // magic, body size, checksum
+
+// FNV-1a over a byte range
+static uint64_t fnv1a(const char *data, size_t size, uint64_t h = 0xCBF29CE484222325ULL) {
+  for(size_t i = 0; i < size; i++) {
+    h = (h ^ static_cast<unsigned char>(data[i])) * 0x100000001B3ULL;
+  }
+  return h;
+}
+
+namespace {
+  // Appends fixed-size values to a record
+  struct Writer {
+    string &out;
+    template<typename T> void put(T value) { out.append(reinterpret_cast<const char*>(&value), sizeof(T)); }
+  };
+
+  // Reads fixed-size values from a record; fails instead of reading past the end
+  struct Reader {
+    const char *at;
+    const char *end;
+    template<typename T> bool get(T &value) {
+      if (size_t(end - at) < sizeof(T)) return false;
+      std::memcpy(&value, at, sizeof(T));
+      at += sizeof(T);
+      return true;
+    }
+  };
+}
+
+void ResultCache::canonical_key(const Expression &expression, vector<uint64_t> &minterms, vector<uint64_t> &dontcares) {
+  minterms.assign(expression.minterms.begin(), expression.minterms.end());
+  dontcares.assign(expression.dontcares.begin(), expression.dontcares.end());
+  for(auto *terms : {&minterms, &dontcares}) {
+    std::sort(terms->begin(), terms->end());
+    terms->erase(std::unique(terms->begin(), terms->end()), terms->end());
+  }
+}
+
+uint64_t ResultCache::fingerprint(int variables, const vector<uint64_t> &minterms, const vector<uint64_t> &dontcares) {
+  uint64_t sizes[3] = {uint64_t(variables), minterms.size(), dontcares.size()};
+  uint64_t h = fnv1a(reinterpret_cast<const char*>(sizes), sizeof(sizes));
+  h = fnv1a(reinterpret_cast<const char*>(minterms.data()), minterms.size() * sizeof(uint64_t), h);
+  return fnv1a(reinterpret_cast<const char*>(dontcares.data()), dontcares.size() * sizeof(uint64_t), h);
+}
+
+bool ResultCache::open(const string &_path) {
+  path = _path;
+  index.clear();
+  if (!file.open(path)) return false;
+
+  // Index every complete, intact record
+  size_t offset = 0;
+  while(offset + RECORD_HEADER <= file.size()) {
+    uint32_t magic, body_size;
+    uint64_t checksum;
+    std::memcpy(&magic, file.data() + offset, 4);
+    std::memcpy(&body_size, file.data() + offset + 4, 4);
+    std::memcpy(&checksum, file.data() + offset + 8, 8);
+    size_t body = offset + RECORD_HEADER;
+    if (magic != RECORD_MAGIC || body_size < 8 || body_size > file.size() - body) break;
+    if (fnv1a(file.data() + body, body_size) != checksum) break;
+
+    uint64_t key;
+    std::memcpy(&key, file.data() + body, 8);
+    index[key].push_back(body);
+    offset = body + body_size;
+  }
+  return true;
+}
+
+bool ResultCache::decode(size_t body, int variables, const vector<uint64_t> &minterms,
+                         const vector<uint64_t> &dontcares, CachedResult &result) const {
+  uint32_t body_size;
+  std::memcpy(&body_size, file.data() + body - RECORD_HEADER + 4, 4);
+  Reader in{file.data() + body, file.data() + body + body_size};
+
+  uint64_t key;
+  uint32_t bits, n_min, n_dc, n_pi, n_sol, n_min_cost;
+  if (!in.get(key) || !in.get(bits) || !in.get(n_min) || !in.get(n_dc) || !in.get(n_pi) ||
+      !in.get(n_sol) || !in.get(n_min_cost)) return false;
+
+  // Full key comparison
+  if (int(bits) != variables || n_min != minterms.size() || n_dc != dontcares.size()) return false;
+  for(const auto *terms : {&minterms, &dontcares}) {
+    for(uint64_t expected : *terms) {
+      uint64_t term;
+      if (!in.get(term) || term != expected) return false;
+    }
+  }
+
+  result.primes.clear();
+  result.primes.reserve(n_pi);
+  for(uint32_t i = 0; i < n_pi; i++) {
+    uint64_t value, mask;
+    if (!in.get(value) || !in.get(mask)) return false;
+    result.primes.emplace_back(Implicant::word(value), Implicant::word(mask), variables);
+  }
+  result.essentials.assign(n_pi, false);
+  for(uint32_t i = 0; i < n_pi; i++) {
+    uint8_t flag;
+    if (!in.get(flag)) return false;
+    result.essentials[i] = flag != 0;
+  }
+
+  auto read_solutions = [&](uint32_t count, vector<vector<int>> &solutions) {
+    solutions.assign(count, {});
+    for(auto &solution : solutions) {
+      uint32_t size;
+      if (!in.get(size)) return false;
+      solution.resize(size);
+      for(int &idx : solution) {
+        uint32_t pi;
+        if (!in.get(pi) || pi >= n_pi) return false;
+        idx = int(pi);
+      }
+    }
+    return true;
+  };
+  return read_solutions(n_sol, result.solutions) && read_solutions(n_min_cost, result.min_cost_solutions);
+}
+
+bool ResultCache::lookup(const Expression &expression, CachedResult &result) {
+  vector<uint64_t> minterms, dontcares;
+  canonical_key(expression, minterms, dontcares);
+  auto it = index.find(fingerprint(expression.numberOfBits, minterms, dontcares));
+  if (it != index.end()) {
+    for(size_t body : it->second) {
+      if (decode(body, expression.numberOfBits, minterms, dontcares, result)) {
+        hit_count++;
+        return true;
+      }
+    }
+  }
+  miss_count++;
+  return false;
+}
+
+void ResultCache::store(const Expression &expression, const CachedResult &result) {
+  vector<uint64_t> minterms, dontcares;
+  canonical_key(expression, minterms, dontcares);
+
+  string body;
+  Writer out{body};
+  out.put(fingerprint(expression.numberOfBits, minterms, dontcares));
+  out.put(uint32_t(expression.numberOfBits));
+  out.put(uint32_t(minterms.size()));
+  out.put(uint32_t(dontcares.size()));
+  out.put(uint32_t(result.primes.size()));
+  out.put(uint32_t(result.solutions.size()));
+  out.put(uint32_t(result.min_cost_solutions.size()));
+  for(uint64_t term : minterms) out.put(term);
+  for(uint64_t term : dontcares) out.put(term);
+  for(const auto &pi : result.primes) {
+    out.put(uint64_t(pi.get_value()));
+    out.put(uint64_t(pi.get_mask()));
+  }
+  for(size_t i = 0; i < result.primes.size(); i++) {
+    out.put(uint8_t(i < result.essentials.size() && result.essentials[i]));
+  }
+  for(const auto *solutions : {&result.solutions, &result.min_cost_solutions}) {
+    for(const auto &solution : *solutions) {
+      out.put(uint32_t(solution.size()));
+      for(int idx : solution) out.put(uint32_t(idx));
+    }
+  }
+
+  string record;
+  Writer header{record};
+  header.put(RECORD_MAGIC);
+  header.put(uint32_t(body.size()));
+  header.put(fnv1a(body.data(), body.size()));
+  record += body;
+
+  std::lock_guard<std::mutex> guard(pending_lock);
+  pending += record;
+  stored++;
+}
+
+bool ResultCache::flush() {
+  std::lock_guard<std::mutex> guard(pending_lock);
+  if (pending.empty()) return true;
+  if (!MappedFile::append_locked(path, pending)) return false;
+  pending.clear();
+  return true;
+}
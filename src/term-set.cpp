@@ -0,0 +1,139 @@
+#include "../include/term-set.h"
+#include <cassert>
+#include <iterator>
+#include <utility>
+
+// Constructors
+TermSet::TermSet(int _numberOfBits) : numberOfBits(_numberOfBits) {}
+
+TermSet::TermSet(int _numberOfBits, const vector<Term> &_terms) : numberOfBits(_numberOfBits) {
+  if (fits_dense(numberOfBits, _terms.size())) {
+    dense = true;
+    bits.assign(word_count(), 0);
+    for(Term term : _terms) bits[term >> 6] |= uint64_t(1) << (term & 63);
+    count = 0;
+    for(uint64_t word : bits) count += __builtin_popcountll(word);
+  } else {
+    terms = _terms;
+    std::sort(terms.begin(), terms.end());
+    terms.erase(std::unique(terms.begin(), terms.end()), terms.end());
+    count = terms.size();
+  }
+  fit();
+}
+
+TermSet TermSet::from_bitmap(int variables, vector<uint64_t> &&bitmap) {
+  TermSet result(variables);
+  assert(variables <= MAX_DENSE_BITS && bitmap.size() == result.word_count());
+  result.dense = true;
+  result.bits = std::move(bitmap);
+  result.bits.back() &= result.tail_mask();
+  for(uint64_t word : result.bits) result.count += __builtin_popcountll(word);
+  result.fit();
+  return result;
+}
+
+bool TermSet::fits_dense(int variables, size_t terms) {
+  return variables <= MAX_DENSE_BITS && bitmap_words(variables) <= terms;
+}
+
+uint64_t TermSet::tail_mask() const {
+  return numberOfBits >= 6 ? ~uint64_t(0) : (uint64_t(1) << (size_t(1) << numberOfBits)) - 1;
+}
+
+void TermSet::fit() {
+  bool want = fits_dense(numberOfBits, count);
+  if (want && !dense) to_dense();
+  else if (!want && dense) to_sparse();
+}
+
+void TermSet::to_dense() {
+  bits.assign(word_count(), 0);
+  for(Term term : terms) bits[term >> 6] |= uint64_t(1) << (term & 63);
+  vector<Term>().swap(terms);
+  dense = true;
+}
+
+void TermSet::to_sparse() {
+  terms.clear();
+  terms.reserve(count);
+  to_vector(terms);
+  vector<uint64_t>().swap(bits);
+  dense = false;
+}
+
+TermSet TermSet::complement() const {
+  assert(numberOfBits <= MAX_DENSE_BITS);
+  TermSet result(numberOfBits);
+  result.dense = true;
+  if (dense) {
+    result.bits.resize(bits.size());
+    for(size_t w = 0; w < bits.size(); w++) result.bits[w] = ~bits[w];
+  } else {
+    result.bits.assign(word_count(), ~uint64_t(0));
+    for(Term term : terms) result.bits[term >> 6] &= ~(uint64_t(1) << (term & 63));
+  }
+  result.bits.back() &= tail_mask();
+  result.count = (size_t(1) << numberOfBits) - count;
+  result.fit();
+  return result;
+}
+
+TermSet TermSet::united(const TermSet &other) const {
+  assert(numberOfBits == other.numberOfBits);
+  TermSet result(numberOfBits);
+  if (dense || other.dense) {
+    // A dense operand means the union is dense too
+    const TermSet &d = dense ? *this : other;
+    const TermSet &o = dense ? other : *this;
+    result.dense = true;
+    result.bits = d.bits;
+    if (o.dense) {
+      for(size_t w = 0; w < result.bits.size(); w++) result.bits[w] |= o.bits[w];
+    } else {
+      for(Term term : o.terms) result.bits[term >> 6] |= uint64_t(1) << (term & 63);
+    }
+    for(uint64_t word : result.bits) result.count += __builtin_popcountll(word);
+  } else {
+    std::set_union(terms.begin(), terms.end(), other.terms.begin(), other.terms.end(), std::back_inserter(result.terms));
+    result.count = result.terms.size();
+  }
+  result.fit();
+  return result;
+}
+
+TermSet TermSet::without(const TermSet &other) const {
+  assert(numberOfBits == other.numberOfBits);
+  TermSet result(numberOfBits);
+  if (dense) {
+    result.dense = true;
+    result.bits = bits;
+    if (other.dense) {
+      for(size_t w = 0; w < result.bits.size(); w++) result.bits[w] &= ~other.bits[w];
+    } else {
+      for(Term term : other.terms) result.bits[term >> 6] &= ~(uint64_t(1) << (term & 63));
+    }
+    for(uint64_t word : result.bits) result.count += __builtin_popcountll(word);
+  } else {
+    for(Term term : terms) {
+      if (!other.contains(term)) result.terms.push_back(term);
+    }
+    result.count = result.terms.size();
+  }
+  result.fit();
+  return result;
+}
+
+void TermSet::to_vector(vector<Term> &output) const {
+  output.clear();
+  if (!dense) {
+    output = terms;
+    return;
+  }
+  output.reserve(count);
+  for(size_t w = 0; w < bits.size(); w++) {
+    for(uint64_t rest = bits[w]; rest; rest &= rest - 1) {
+      output.push_back(Term(w) * 64 + __builtin_ctzll(rest));
+    }
+  }
+}
@@ -0,0 +1,87 @@
+#include "../include/ternary-engine.h"
+
+// Cell flags
+static const uint8_t IMPLICANT = 1;
+
+// Constructors
+TernaryEngine::TernaryEngine(int _numberOfBits) : numberOfBits(_numberOfBits) {}
+
+size_t TernaryEngine::table_size(int variables) {
+  size_t cells = 1;
+  for(int i = 0; i < variables; i++) {
+    if (cells > SIZE_MAX / 3) return SIZE_MAX;
+    cells *= 3;
+  }
+  return cells;
+}
+
+void TernaryEngine::generate_primes(const vector<Term> &minterms, const vector<Term> &dontcares,
+                                    vector<Implicant> &primes) const {
+  using word = Implicant::word;
+
+  primes.clear();
+  const int n = numberOfBits;
+  const size_t cells = table_size(n);
+  assert(cells != SIZE_MAX);
+
+  // power[i] = 3^i, the index step of variable i
+  vector<size_t> power(n + 1, 1);
+  for(int i = 1; i <= n; i++) power[i] = power[i - 1] * 3;
+
+  // Care points are the cubes without dashes: digit i is bit i of the term
+  vector<uint8_t> cube(cells, 0);
+  for(const auto *terms : {&minterms, &dontcares}) {
+    for(Term term : *terms) {
+      size_t index = 0;
+      for(Term rest = term; rest; rest &= rest - 1) index += power[__builtin_ctzll(rest)];
+      cube[index] = IMPLICANT;
+    }
+  }
+
+  // Cells come in triples that differ only in variable 0 (digit 0, 1, 2); the odometer walks the
+  // digits of variables 1 .. n - 1 once per triple
+  vector<uint8_t> digit(n, 0);
+  auto advance = [&]() {
+    for(int i = 1; i < n; i++) {
+      if (++digit[i] < 3) return;
+      digit[i] = 0;
+    }
+  };
+
+  // Pass 1: a cube with a dash is an implicant when both cofactors along its lowest dash are
+  for(size_t c = 0; c < cells; c += 3, advance()) {
+    int i = 1;
+    while(i < n && digit[i] != 2) i++;
+    if (i < n) {
+      cube[c] = cube[c - 2 * power[i]] & cube[c - power[i]];
+      cube[c + 1] = cube[c + 1 - 2 * power[i]] & cube[c + 1 - power[i]];
+    }
+    cube[c + 2] = cube[c] & cube[c + 1];
+  }
+
+  // Pass 2: an implicant is prime when dashing any fixed variable leaves the care set
+  for(size_t c = 0; c < cells; c += 3, advance()) {
+    if (!((cube[c] | cube[c + 1] | cube[c + 2]) & IMPLICANT)) continue;
+
+    // Variables 1 .. n - 1 are shared by the triple
+    word value = 0, mask = 0;
+    for(int i = 1; i < n; i++) {
+      if (digit[i] == 2) mask |= word(1) << i;
+      else if (digit[i] == 1) value |= word(1) << i;
+    }
+
+    for(int k = 0; k < 3; k++) {
+      size_t cell = c + k;
+      if (!(cube[cell] & IMPLICANT)) continue;
+
+      // Dashing variable 0 gives the third cell of the triple
+      bool prime = (k == 2) || !(cube[c + 2] & IMPLICANT);
+      for(int i = 1; i < n && prime; i++) {
+        if (digit[i] != 2 && (cube[cell + (2 - digit[i]) * power[i]] & IMPLICANT)) prime = false;
+      }
+      if (prime) {
+        primes.emplace_back(value | ((k == 1) ? word(1) : word(0)), mask | ((k == 2) ? word(1) : word(0)), n);
+      }
+    }
+  }
+}
@@ -0,0 +1,131 @@
+#include "../include/thread-pool.h"
+#include <algorithm>
+
+// Constructors
+ThreadPool::ThreadPool(size_t thread_count) : queued(0), next_queue(0), stopping(false) {
+  if (thread_count == 0) thread_count = 1;
+
+  for(size_t i = 0; i < thread_count; i++) {
+    queues.push_back(std::make_unique<Queue>());
+  }
+  for(size_t i = 0; i < thread_count; i++) {
+    workers.emplace_back(&ThreadPool::worker_loop, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> guard(sleep_lock);
+    stopping = true;
+  }
+  wake.notify_all();
+  for(auto &worker : workers) {
+    worker.join();
+  }
+}
+
+ThreadPool& ThreadPool::shared() {
+  static ThreadPool pool(std::thread::hardware_concurrency());
+  return pool;
+}
+
+void ThreadPool::push(size_t queue_idx, Task task) {
+  std::lock_guard<std::mutex> guard(queues[queue_idx]->lock);
+  queues[queue_idx]->tasks.push_back(std::move(task));
+  queued.fetch_add(1);
+}
+
+// Pops from the back of the home queue, otherwise steals from the front of another one
+bool ThreadPool::try_pop(size_t home, Task &task) {
+  {
+    Queue &own = *queues[home];
+    std::lock_guard<std::mutex> guard(own.lock);
+    if (!own.tasks.empty()) {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      queued.fetch_sub(1);
+      return true;
+    }
+  }
+
+  for(size_t offset = 1; offset < queues.size(); offset++) {
+    Queue &victim = *queues[(home + offset) % queues.size()];
+    std::lock_guard<std::mutex> guard(victim.lock);
+    if (!victim.tasks.empty()) {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      queued.fetch_sub(1);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void ThreadPool::worker_loop(size_t home) {
+  Task task;
+  while(true) {
+    if (try_pop(home, task)) {
+      task();
+      continue;
+    }
+
+    std::unique_lock<std::mutex> guard(sleep_lock);
+    wake.wait(guard, [&] { return stopping || queued.load() > 0; });
+    if (stopping && queued.load() == 0) return;
+  }
+}
+
+void ThreadPool::parallel_for(size_t count, const std::function<void(size_t)> &body, size_t max_threads) {
+  if (count == 0) return;
+
+  // The calling thread runs tiles too, so it counts against the limit
+  size_t threads = (max_threads == 0) ? workers.size() : std::min(max_threads, workers.size());
+  threads = std::min(threads, count);
+
+  // A single tile or a single thread gains nothing from the queues
+  if (threads <= 1) {
+    for(size_t i = 0; i < count; i++) body(i);
+    return;
+  }
+
+  // Completion state shared by this call's runners; a runner may still hold it after the caller
+  // returned, so it is owned jointly
+  struct Batch {
+    std::atomic<size_t> next{0};
+    size_t remaining;
+    std::mutex lock;
+    std::condition_variable done;
+  };
+  auto batch = std::make_shared<Batch>();
+  batch->remaining = count;
+
+  // Each runner claims tiles in order until none are left, then reports how many it finished
+  auto run = [count, &body](Batch &state) {
+    size_t finished = 0;
+    for(size_t i = state.next.fetch_add(1); i < count; i = state.next.fetch_add(1)) {
+      body(i);
+      finished++;
+    }
+    if (finished == 0) return;
+    std::lock_guard<std::mutex> guard(state.lock);
+    state.remaining -= finished;
+    if (state.remaining == 0) state.done.notify_all();
+  };
+
+  // Spread the helpers round-robin so every one starts on a different queue; a helper that starts
+  // after the tiles ran out returns at once
+  size_t first = next_queue.fetch_add(1);
+  for(size_t t = 1; t < threads; t++) {
+    push((first + t) % queues.size(), [batch, run] { run(*batch); });
+  }
+  {
+    std::lock_guard<std::mutex> guard(sleep_lock);
+  }
+  wake.notify_all();
+
+  // Work alongside the helpers, then wait for the tiles they are still running
+  run(*batch);
+  std::unique_lock<std::mutex> guard(batch->lock);
+  batch->done.wait(guard, [&] { return batch->remaining == 0; });
+}
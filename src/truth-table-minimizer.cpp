@@ -0,0 +1,60 @@
+#include "../include/truth-table-minimizer.h"
+#include <algorithm>
+
+template<int N>
+static void run(uint64_t on, uint64_t dc, size_t limit, vector<Implicant> &pe,
+                vector<bool> &epi, vector<vector<int>> &solutions) {
+  Minimizer<N> minimizer(on, dc);
+  int count = minimizer.generate_primes();
+
+  pe.clear();
+  pe.reserve(count);
+  for(int p = 0; p < count; p++) {
+    pe.emplace_back(minimizer.prime(p).value, minimizer.prime(p).mask, N);
+  }
+
+  auto essential = minimizer.essential_primes();
+  epi.assign(count, false);
+  for(int p = 0; p < count; p++) epi[p] = (essential[p >> 6] >> (p & 63)) & 1;
+
+  // Each solution lists its other PIs in ascending order, then the EPIs
+  solutions.clear();
+  minimizer.for_each_minimum_cover([&](const std::array<int, Minimizer<N>::TERMS> &chosen, int size) {
+    vector<int> solution;
+    vector<int> essentials;
+    for(int i = 0; i < size; i++) {
+      (epi[chosen[i]] ? essentials : solution).push_back(chosen[i]);
+    }
+    std::sort(solution.begin(), solution.end());
+    std::sort(essentials.begin(), essentials.end());
+    solution.insert(solution.end(), essentials.begin(), essentials.end());
+    solutions.push_back(std::move(solution));
+    return limit == 0 || solutions.size() < limit;
+  });
+}
+
+bool truth_table_minimize(const Expression &expression, size_t limit, vector<Implicant> &pe,
+                          vector<bool> &epi, vector<vector<int>> &solutions) {
+  int n = expression.numberOfBits;
+  if (n < 1 || n > 6) return false;
+
+  uint64_t on = 0, dc = 0;
+  for(Term term : expression.minterms) {
+    if (!expression.in_range(term)) return false;
+    on |= uint64_t(1) << term;
+  }
+  for(Term term : expression.dontcares) {
+    if (!expression.in_range(term)) return false;
+    dc |= uint64_t(1) << term;
+  }
+
+  switch(n) {
+    case 1: run<1>(on, dc, limit, pe, epi, solutions); break;
+    case 2: run<2>(on, dc, limit, pe, epi, solutions); break;
+    case 3: run<3>(on, dc, limit, pe, epi, solutions); break;
+    case 4: run<4>(on, dc, limit, pe, epi, solutions); break;
+    case 5: run<5>(on, dc, limit, pe, epi, solutions); break;
+    default: run<6>(on, dc, limit, pe, epi, solutions); break;
+  }
+  return true;
+}
@@ -0,0 +1,48 @@
+#include "../include/unate-engine.h"
+#include "../include/cube-cover.h"
+#include <algorithm>
+
+// Constructors
+UnateEngine::UnateEngine(int _numberOfBits) : numberOfBits(_numberOfBits) {}
+
+void UnateEngine::generate_primes(const vector<Term> &minterms, const vector<Term> &dontcares,
+                                  const vector<Implicant> &cubes, vector<Implicant> &primes) const {
+  // Cubes enter the cover as they are
+  vector<Implicant> cover(cubes);
+  cover.reserve(cubes.size() + minterms.size() + dontcares.size());
+  for(Term term : minterms) cover.emplace_back(term, numberOfBits);
+  for(Term term : dontcares) cover.emplace_back(term, numberOfBits);
+
+  primes_of(cover, primes);
+  std::sort(primes.begin(), primes.end());
+}
+
+void UnateEngine::primes_of(const vector<Implicant> &cover, vector<Implicant> &primes) const {
+  using word = Implicant::word;
+
+  primes = cover;
+  cube_cover::remove_contained(primes);
+
+  // Unate leaf (this includes the empty cover and a cover holding the universe)
+  int bit = cube_cover::most_binate_bit(primes);
+  if (bit < 0) return;
+
+  vector<Implicant> half, low_primes, high_primes;
+  cube_cover::cofactor(primes, bit, false, half);
+  primes_of(half, low_primes);
+  cube_cover::cofactor(primes, bit, true, half);
+  primes_of(half, high_primes);
+
+  // Merge: each half with its literal back, plus the consensus terms across the split bit
+  const word b = word(1) << bit;
+  primes.clear();
+  for(const auto &p : low_primes) primes.emplace_back(p.get_value(), p.get_mask() & ~b, numberOfBits);
+  for(const auto &q : high_primes) primes.emplace_back(q.get_value() | b, q.get_mask() & ~b, numberOfBits);
+  Implicant consensus(word(0), word(0), numberOfBits);
+  for(const auto &p : low_primes) {
+    for(const auto &q : high_primes) {
+      if (cube_cover::intersect(p, q, consensus)) primes.push_back(consensus);
+    }
+  }
+  cube_cover::remove_contained(primes);
+}
@@ -282,9 +282,10 @@ string VerilogGenerator::render_verilog_case() {
     ss << render_all_solutions_comments() << "\n";
   }
   
-  // Generate case statement
+  // Generate case statement; minterm cubes need casez so their dashes can match either value
+  bool wildcard = !main_ex.minterm_cubes.empty();
   ss << "    always @(*) begin\n";
-  ss << "        case ({";
+  ss << "        " << (wildcard ? "casez" : "case") << " ({";
   for(int i = 0; i < main_ex.numberOfBits; i++) {
     ss << input_names[i];
     if (i < main_ex.numberOfBits - 1) ss << ", ";
@@ -292,13 +293,23 @@ string VerilogGenerator::render_verilog_case() {
   ss << "})\n";
   
   // Generate case items for each minterm
-  for(int minterm : main_ex.minterms) {
+  for(Term minterm : main_ex.minterms) {
     ss << "            " << main_ex.numberOfBits << "'b";
     for(int i = main_ex.numberOfBits - 1; i >= 0; i--) {
       ss << ((minterm >> i) & 1);
     }
     ss << ": " << escaped_output << " = 1'b1;\n";
   }
+
+  // One item per minterm cube, with ? for each dash
+  for(const auto &cube : main_ex.minterm_cubes) {
+    ss << "            " << main_ex.numberOfBits << "'b";
+    for(int i = main_ex.numberOfBits - 1; i >= 0; i--) {
+      if ((cube.get_mask() >> i) & 1) ss << '?';
+      else ss << ((cube.get_value() >> i) & 1);
+    }
+    ss << ": " << escaped_output << " = 1'b1;\n";
+  }
   
   ss << "            default: " << escaped_output << " = 1'b0;\n";
   ss << "        endcase\n";
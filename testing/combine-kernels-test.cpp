@@ -0,0 +1,103 @@
+// Checks that every combine and probe kernel the CPU supports agrees with the scalar one
+#include "combine-kernels.h"
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace combine_kernels;
+
+int main() {
+  std::mt19937_64 rng(5);
+  struct Candidate {
+    CombineKernel kernel;
+    KernelFn run;
+    const char *name;
+  };
+  const Candidate kernels[] = {
+    {CombineKernel::$avx2, find_neighbors_avx2, "avx2"},
+    {CombineKernel::$avx512, find_neighbors_avx512, "avx512"},
+  };
+
+  size_t cases = 0, failures = 0;
+  for(int round = 0; round < 20000; round++) {
+    // Every length up to a few vectors, so each tail length is hit
+    size_t count = round % 40;
+    int bits = 1 + round % 64;
+    word all = (bits == 64) ? ~word(0) : (word(1) << bits) - 1;
+
+    // Few masks and values close to the probe, so matches are common
+    word mask = rng() & all & rng();
+    word value = rng() & all & ~mask;
+    vector<word> values(count), masks(count);
+    for(size_t k = 0; k < count; k++) {
+      masks[k] = (rng() % 4) ? mask : (rng() & all);
+      switch(rng() % 3) {
+        case 0: values[k] = value ^ (word(1) << (rng() % bits)); break;
+        case 1: values[k] = value; break;
+        default: values[k] = rng() & all; break;
+      }
+    }
+
+    vector<uint32_t> expected(count + 1), actual(count + 1);
+    size_t found = find_neighbors_scalar(value, mask, values.data(), masks.data(), count, expected.data());
+    expected.resize(found);
+    for(const Candidate &candidate : kernels) {
+      if (!is_supported(candidate.kernel)) continue;
+      actual.assign(count + 1, 0);
+      actual.resize(candidate.run(value, mask, values.data(), masks.data(), count, actual.data()));
+      cases++;
+      if (actual != expected) {
+        if (failures++ < 10) std::cerr << candidate.name << " differs from scalar on " << count << " candidates\n";
+      }
+    }
+  }
+
+  // Probe kernels: tables of every load up to half full, blocks of present points with at most
+  // one absent point somewhere in them
+  struct Probe {
+    CombineKernel kernel;
+    ProbeFn run;
+    const char *name;
+  };
+  const Probe probes[] = {
+    {CombineKernel::$avx2, contains_all_avx2, "avx2"},
+    {CombineKernel::$avx512, contains_all_avx512, "avx512"},
+  };
+  for(int round = 0; round < 2000; round++) {
+    int bits = 1 + round % 12;
+    size_t size = size_t(1) << bits;
+    // Few distinct home slots on some rounds, so long collision chains get probed too
+    word spread = (round % 3 == 0) ? 7 : ~word(0);
+    vector<word> slots(size, EMPTY_SLOT), present;
+    for(size_t k = 0; k < size / 2 && k < 1 + rng() % size; k++) {
+      word point = (rng() & spread) * 0x10001;
+      if (point == EMPTY_SLOT || std::find(present.begin(), present.end(), point) != present.end()) continue;
+      size_t slot = probe_slot(point, bits);
+      while(slots[slot] != EMPTY_SLOT) slot = (slot + 1) & (size - 1);
+      slots[slot] = point;
+      present.push_back(point);
+    }
+    if (present.empty()) continue;
+
+    size_t count = round % 40;
+    vector<word> points(count);
+    for(word &point : points) point = present[rng() % present.size()];
+    if (count > 0 && rng() % 2) points[rng() % count] = (rng() | 1) * 0x20003;
+
+    bool expected = contains_all_scalar(slots.data(), bits, points.data(), count);
+    for(const Probe &probe : probes) {
+      if (!is_supported(probe.kernel)) continue;
+      cases++;
+      if (probe.run(slots.data(), bits, points.data(), count) != expected) {
+        if (failures++ < 10) std::cerr << probe.name << " probe differs from scalar on " << count << " points\n";
+      }
+    }
+  }
+
+  for(const Candidate &candidate : kernels) {
+    if (!is_supported(candidate.kernel)) std::cout << candidate.name << ": not supported here, skipped\n";
+  }
+  std::cout << cases << " kernel runs, " << failures << " mismatches\n";
+  return failures == 0 ? 0 : 1;
+}
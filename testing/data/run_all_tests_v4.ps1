@@ -16,6 +16,8 @@ Notes:
 - The script assumes the built executable is at: project_root/build/QM_Algorithm_Implementation.exe
   relative to this script it resolves to: ..\..\build\QM_Algorithm_Implementation.exe
 - Running all 65,536 functions will take time. Consider testing a small sample first.
+- The batch mode minimizes every file in one process and is much faster:
+    build\QM_Algorithm_Implementation.exe --batch testing\data\v4 v4_results.txt
 
 Usage:
   Set-Location <project-root> (optional)
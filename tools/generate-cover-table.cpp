@@ -0,0 +1,87 @@
+// Writes the precomputed cover table (see include/cover-table.h) as a C++ source file.
+// Usage: generate-cover-table <output.cpp>
+//
+// Every function of 1 to 4 variables without don't cares is minimized with the regular
+// engine; the entries are checked to decode back to exactly what the engine returned.
+
+#include "../include/qm-minimizer.h"
+#include "../include/cover-table.h"
+#include <iostream>
+#include <fstream>
+
+using namespace std;
+
+int main(int argc, char *argv[]) {
+  if (argc != 2) {
+    cerr << "Usage: " << argv[0] << " <output.cpp>\n";
+    return 1;
+  }
+
+  vector<uint32_t> offsets;
+  vector<unsigned char> data;
+
+  for(int n = 1; n <= cover_table::MAX_VARIABLES; n++) {
+    const uint32_t functions = uint32_t(1) << (1 << n);
+    for(uint32_t table = 0; table < functions; table++) {
+      Expression expression;
+      expression.numberOfBits = n;
+      for(int m = 0; m < (1 << n); m++) {
+        if ((table >> m) & 1) expression.minterms.push_back(m);
+      }
+
+      vector<Implicant> primes;
+      vector<bool> essentials;
+      vector<int> epi_coverage;
+      vector<vector<Implicant>> expressions;
+      vector<vector<int>> solutions;
+      QMMinimizer qm(expression);
+      qm.set_thread_count(1);
+      qm.set_use_truth_table(false);
+      qm.minimize(primes, essentials, epi_coverage, expressions, solutions);
+
+      if (primes.size() > size_t(cover_table::MAX_PRIMES) || solutions.size() > 0xFFFF) {
+        cerr << "Error: " << n << "-variable function " << table << " does not fit the table format\n";
+        return 1;
+      }
+
+      offsets.push_back(static_cast<uint32_t>(data.size()));
+      size_t start = data.size();
+      cover_table::encode(primes, essentials, solutions, data);
+
+      // The entry must give back exactly what the engine returned
+      vector<Implicant> decoded_primes;
+      vector<bool> decoded_essentials;
+      vector<vector<int>> decoded_solutions;
+      cover_table::decode(data.data() + start, n, decoded_primes, decoded_essentials, decoded_solutions);
+      if (decoded_primes != primes || decoded_essentials != essentials || decoded_solutions != solutions) {
+        cerr << "Error: entry of " << n << "-variable function " << table << " does not round-trip\n";
+        return 1;
+      }
+    }
+  }
+  offsets.push_back(static_cast<uint32_t>(data.size()));
+
+  ofstream out(argv[1]);
+  if (!out.is_open()) {
+    cerr << "Error: Could not create '" << argv[1] << "'\n";
+    return 1;
+  }
+
+  out << "// Generated by tools/generate-cover-table.cpp; do not edit.\n";
+  out << "#include \"cover-table.h\"\n\n";
+  out << "namespace cover_table {\n\n";
+  out << "  const uint32_t OFFSETS[] = {\n";
+  for(size_t i = 0; i < offsets.size(); i++) {
+    out << (i % 12 == 0 ? "    " : "") << offsets[i] << ((i % 12 == 11 || i + 1 == offsets.size()) ? ",\n" : ",");
+  }
+  out << "  };\n\n";
+  out << "  const unsigned char DATA[] = {\n";
+  for(size_t i = 0; i < data.size(); i++) {
+    out << (i % 32 == 0 ? "    " : "") << unsigned(data[i]) << ((i % 32 == 31 || i + 1 == data.size()) ? ",\n" : ",");
+  }
+  out << "  };\n\n";
+  out << "}\n";
+
+  cout << "Cover table: " << (offsets.size() - 1) << " functions, " << data.size() << " bytes\n";
+  return 0;
+}
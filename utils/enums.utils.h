@@ -8,4 +8,39 @@ enum class ImplicantBit {
     $dash    // Represents '-' (don't care)
 };
 
+// Enum for selecting the prime implicant generator
+enum class PrimeEngine {
+    $auto,      // Off-set engine when the off-set is tiny, ternary table for dense functions that fit
+                // the memory budget, cube expansion otherwise
+    $classic,   // Pairwise comparison of adjacent popcount groups
+    $hash_join, // Dash-mask buckets probed by single-bit neighbor lookup
+    $expansion, // Cubes grown directly from each care point (sparse functions)
+    $ternary,   // Base-3 indexed table of all 3^n cubes (dense mid-size functions)
+    $unate,     // Unate recursive cofactoring with consensus merge (large structured functions)
+    $offset     // Iterative sharp of the off-set points from the universe (functions that are almost all 1s)
+};
+
+// Enum for selecting the pairwise combine kernel
+enum class CombineKernel {
+    $auto,    // Widest kernel the CPU supports
+    $scalar,  // Portable fallback
+    $avx2,    // 4 candidates per instruction
+    $avx512   // 8 candidates per instruction
+};
+
+// Enum for selecting the covering solver
+enum class CoverEngine {
+    $auto,             // Petrick while its product stays small, branch and bound otherwise
+    $petrick,          // Product-of-sums expansion; every minimum solution
+    $branch_and_bound  // Exact unate covering; one minimum solution
+};
+
+// Enum for reporting how minimize produced its result
+enum class MinimizePath {
+    $general,     // Prime generation, cyclic-core reduction and covering
+    $cover_table, // Precomputed table of functions of up to 4 variables
+    $truth_table, // Minimizer<N> on 64-bit truth tables (up to 6 variables)
+    $heuristic    // EspressoMinimizer: near-minimal prime and irredundant cover
+};
+
 #endif // ENUMS_UTILS_H
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include "mapped_file.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+#ifdef _WIN32
+
+bool MappedFile::open(const string &path) {
+  close();
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return GetLastError() == ERROR_FILE_NOT_FOUND || GetLastError() == ERROR_PATH_NOT_FOUND;
+  }
+
+  LARGE_INTEGER file_size;
+  if (!GetFileSizeEx(file, &file_size)) {
+    CloseHandle(file);
+    return false;
+  }
+  if (file_size.QuadPart == 0) {
+    CloseHandle(file);
+    return true;
+  }
+
+  HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping) {
+    CloseHandle(file);
+    return false;
+  }
+  const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!view) {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return false;
+  }
+
+  file_handle = file;
+  mapping_handle = mapping;
+  bytes = static_cast<const char *>(view);
+  length = static_cast<size_t>(file_size.QuadPart);
+  return true;
+}
+
+void MappedFile::close() {
+  if (bytes) UnmapViewOfFile(bytes);
+  if (mapping_handle) CloseHandle(static_cast<HANDLE>(mapping_handle));
+  if (file_handle) CloseHandle(static_cast<HANDLE>(file_handle));
+  bytes = nullptr;
+  length = 0;
+  mapping_handle = nullptr;
+  file_handle = nullptr;
+}
+
+bool MappedFile::append_locked(const string &path, const string &data) {
+  HANDLE file = CreateFileA(path.c_str(), FILE_APPEND_DATA, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                            nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) return false;
+
+  OVERLAPPED whole_file = {};
+  bool ok = LockFileEx(file, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &whole_file);
+  size_t written = 0;
+  while (ok && written < data.size()) {
+    DWORD chunk = 0;
+    ok = WriteFile(file, data.data() + written, static_cast<DWORD>(data.size() - written), &chunk, nullptr);
+    written += chunk;
+  }
+  UnlockFileEx(file, 0, MAXDWORD, MAXDWORD, &whole_file);
+  CloseHandle(file);
+  return ok;
+}
+
+#else
+
+bool MappedFile::open(const string &path) {
+  close();
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) return errno == ENOENT;
+
+  struct stat info;
+  if (fstat(fd, &info) != 0) {
+    ::close(fd);
+    return false;
+  }
+  if (info.st_size == 0) {
+    ::close(fd);
+    return true;
+  }
+
+  void *view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd); // The mapping stays valid without the descriptor
+  if (view == MAP_FAILED) return false;
+
+  bytes = static_cast<const char *>(view);
+  length = static_cast<size_t>(info.st_size);
+  return true;
+}
+
+void MappedFile::close() {
+  if (bytes) munmap(const_cast<char *>(bytes), length);
+  bytes = nullptr;
+  length = 0;
+}
+
+bool MappedFile::append_locked(const string &path, const string &data) {
+  int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  if (fd < 0) return false;
+
+  bool ok = flock(fd, LOCK_EX) == 0;
+  size_t written = 0;
+  while (ok && written < data.size()) {
+    ssize_t chunk = ::write(fd, data.data() + written, data.size() - written);
+    if (chunk < 0 && errno == EINTR) continue;
+    ok = chunk > 0;
+    if (ok) written += static_cast<size_t>(chunk);
+  }
+  flock(fd, LOCK_UN);
+  ::close(fd);
+  return ok;
+}
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <cstddef>
+
+using std::string;
+
+// Read-only memory mapping of a whole file (POSIX mmap / Win32 file mapping).
+// A missing or empty file maps as zero bytes. Several processes may map the same
+// file while others append to it with append_locked(); a mapping only sees the
+// bytes that existed when it was opened.
+class MappedFile {
+  const char *bytes = nullptr;
+  size_t length = 0;
+#ifdef _WIN32
+  void *file_handle = nullptr;
+  void *mapping_handle = nullptr;
+#endif
+
+public:
+  MappedFile() = default;
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  ~MappedFile() { close(); }
+
+  // Maps the file; returns false only if it exists and cannot be mapped
+  bool open(const string &path);
+  void close();
+
+  const char *data() const { return bytes; }
+  size_t size() const { return length; }
+
+  // Appends bytes to the file (created if missing) under an exclusive lock so
+  // concurrent writers never interleave their records
+  static bool append_locked(const string &path, const string &data);
+};
+
+#endif // MAPPED_FILE_H